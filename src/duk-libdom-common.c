@@ -21,8 +21,11 @@
 #include "webidl-ast.h"
 #include "ir.h"
 #include "output.h"
+#include "profile.h"
 #include "duk-libdom.h"
 
+#define DLPFX "dukky"
+
 #define NSGENBIND_PREFACE                                               \
     "/* Generated by nsgenbind\n"                                       \
     " *\n"                                                              \
@@ -86,26 +89,156 @@ int output_ccode(struct opctx *outc, struct genbind_node *node)
         return res;
 }
 
-/* exported interface documented in duk-libdom.h */
-int output_tool_prologue(struct opctx *outc)
+/**
+ * generate includes of the private and prototype declarations
+ */
+static int output_private_includes(struct opctx *outc, struct ir_entry *entry)
 {
         char *fpath;
 
-        fpath = genb_fpath("binding.h");
-        outputf(outc, "\n#include \"%s\"\n", fpath);
-        free(fpath);
+        /* only the class header and those it includes are needed */
+        if ((options->splitheaders) &&
+            (entry != NULL) &&
+            (entry->class_name != NULL)) {
+                return output_class_include(outc, entry);
+        }
 
-        fpath = genb_fpath("private.h");
+        fpath = genb_fpath(output_dirname(outc), "private.h");
         outputf(outc, "#include \"%s\"\n", fpath);
         free(fpath);
 
-        fpath = genb_fpath("prototype.h");
+        fpath = genb_fpath(output_dirname(outc), "prototype.h");
         outputf(outc, "#include \"%s\"\n", fpath);
         free(fpath);
 
         return 0;
 }
 
+/* exported interface documented in duk-libdom.h */
+int output_tool_prologue(struct opctx *outc, struct ir_entry *entry)
+{
+        char *fpath;
+
+        fpath = genb_fpath(output_dirname(outc), "binding.h");
+        outputf(outc, "\n#include \"%s\"\n", fpath);
+        free(fpath);
+
+        return output_private_includes(outc, entry);
+}
+
+/* exported interface documented in duk-libdom.h */
+int output_source_preamble(struct opctx *outc,
+                           struct ir *ir,
+                           struct ir_entry *entry)
+{
+        char *fpath;
+
+        /* tool preface */
+        output_tool_preface(outc);
+
+        if (options->commonheader) {
+                /* the shared blocks come first from the common header */
+                fpath = genb_fpath(output_dirname(outc), "common.h");
+                outputf(outc, "\n#include \"%s\"\n", fpath);
+                free(fpath);
+
+                if (!options->splitheaders) {
+                        if (entry == NULL) {
+                                return 0;
+                        }
+
+                        /* class preface */
+                        output_method_cdata(outc,
+                                            entry->class,
+                                            GENBIND_METHOD_TYPE_PREFACE);
+
+                        /* class prologue */
+                        output_method_cdata(outc,
+                                            entry->class,
+                                            GENBIND_METHOD_TYPE_PROLOGUE);
+
+                        return 0;
+                }
+
+                /* class headers are not shared so the class preface,
+                 * the class header and the prologues which may use its
+                 * private types follow in the same order as without
+                 * the common header
+                 */
+                if (entry != NULL) {
+                        output_method_cdata(outc,
+                                            entry->class,
+                                            GENBIND_METHOD_TYPE_PREFACE);
+                }
+
+                outputf(outc, "\n");
+                output_private_includes(outc, entry);
+
+                output_method_cdata(outc,
+                                    ir->binding_node,
+                                    GENBIND_METHOD_TYPE_PROLOGUE);
+
+                if (entry != NULL) {
+                        output_method_cdata(outc,
+                                            entry->class,
+                                            GENBIND_METHOD_TYPE_PROLOGUE);
+                }
+
+                return 0;
+        }
+
+        /* binding preface */
+        output_method_cdata(outc,
+                            ir->binding_node,
+                            GENBIND_METHOD_TYPE_PREFACE);
+
+        /* class preface */
+        if (entry != NULL) {
+                output_method_cdata(outc,
+                                    entry->class,
+                                    GENBIND_METHOD_TYPE_PREFACE);
+        }
+
+        /* tool prologue */
+        output_tool_prologue(outc, entry);
+
+        /* binding prologue */
+        output_method_cdata(outc,
+                            ir->binding_node,
+                            GENBIND_METHOD_TYPE_PROLOGUE);
+
+        /* class prologue */
+        if (entry != NULL) {
+                output_method_cdata(outc,
+                                    entry->class,
+                                    GENBIND_METHOD_TYPE_PROLOGUE);
+        }
+
+        return 0;
+}
+
+
+/* exported interface documented in duk-libdom.h */
+int output_class_include(struct opctx *outc, struct ir_entry *entry)
+{
+        char *fname;
+        char *fpath;
+        int fnamel;
+
+        fnamel = strlen(entry->class_name) + 3;
+        fname = malloc(fnamel);
+        if (fname == NULL) {
+                return -1;
+        }
+        snprintf(fname, fnamel, "%s.h", entry->class_name);
+
+        fpath = genb_fpath(output_dirname(outc), fname);
+        outputf(outc, "#include \"%s\"\n", fpath);
+        free(fpath);
+        free(fname);
+
+        return 0;
+}
 
 /* exported interface documented in duk-libdom.h */
 int output_ctype(struct opctx *outc, struct genbind_node *node, bool identifier)
@@ -177,6 +310,22 @@ int output_method_cdata(struct opctx *outc,
         return 0;
 }
 
+/* exported interface documented in duk-libdom.h */
+const char *gen_key_prefix(void)
+{
+        static char key_prefix[sizeof(DLPFX "_KEY_")];
+        unsigned int idx;
+
+        if (key_prefix[0] == 0) {
+                for (idx = 0; idx < SLEN(DLPFX); idx++) {
+                        key_prefix[idx] = toupper(DLPFX[idx]);
+                }
+                strcpy(key_prefix + idx, "_KEY_");
+        }
+
+        return key_prefix;
+}
+
 /* exported interface documented in duk-libdom.h */
 char *gen_idl2c_name(const char *idlname)
 {
@@ -235,3 +384,91 @@ char *gen_idl2c_name(const char *idlname)
         }
         return name;
 }
+
+/**
+ * sequence element marshalling table
+ *
+ * Each entry generates a push and get helper pair in the binding.
+ */
+const struct sequence_marshal sequence_marshalv[] = {
+        { "string", "const char *", "duk_push_string", "duk_require_string" },
+        { "boolean", "duk_bool_t ", "duk_push_boolean", "duk_require_boolean" },
+        { "int", "duk_int_t ", "duk_push_int", "duk_require_int" },
+        { "number", "duk_double_t ", "duk_push_number", "duk_require_number" },
+        { "longlong", "long long ", "duk_push_number", "(long long)duk_get_number" },
+        { NULL, NULL, NULL, NULL },
+};
+
+/* exported interface documented in duk-libdom.h */
+const struct sequence_marshal *get_sequence_marshal(enum webidl_type type)
+{
+        switch (type) {
+        case WEBIDL_TYPE_STRING:
+                return &sequence_marshalv[0];
+
+        case WEBIDL_TYPE_BOOL:
+                return &sequence_marshalv[1];
+
+        case WEBIDL_TYPE_SHORT:
+        case WEBIDL_TYPE_LONG:
+                return &sequence_marshalv[2];
+
+        case WEBIDL_TYPE_FLOAT:
+        case WEBIDL_TYPE_DOUBLE:
+                return &sequence_marshalv[3];
+
+        case WEBIDL_TYPE_LONGLONG:
+                /* a duk_int_t would narrow the value */
+                return &sequence_marshalv[4];
+
+        default:
+                break;
+        }
+        return NULL;
+}
+
+/* exported interface documented in duk-libdom.h */
+bool get_sequence_element_type(struct webidl_node *type_node,
+                               enum webidl_type *element_type)
+{
+        enum webidl_type *base_type;
+        struct webidl_node *element_node;
+
+        base_type = (enum webidl_type *)webidl_node_getint(
+                webidl_node_find_type(
+                        webidl_node_getnode(type_node),
+                        NULL,
+                        WEBIDL_NODE_TYPE_TYPE_BASE));
+        if (base_type == NULL) {
+                return false;
+        }
+
+        if (*base_type == WEBIDL_TYPE_SEQUENCE) {
+                /* sequence element type is the nested type node */
+                element_node = webidl_node_find_type(
+                        webidl_node_getnode(type_node),
+                        NULL,
+                        WEBIDL_NODE_TYPE_TYPE);
+                base_type = (enum webidl_type *)webidl_node_getint(
+                        webidl_node_find_type(
+                                webidl_node_getnode(element_node),
+                                NULL,
+                                WEBIDL_NODE_TYPE_TYPE_BASE));
+                if (base_type == NULL) {
+                        *element_type = WEBIDL_TYPE_ANY;
+                } else {
+                        *element_type = *base_type;
+                }
+                return true;
+        }
+
+        /* array of the base type */
+        if (webidl_node_find_type(webidl_node_getnode(type_node),
+                                  NULL,
+                                  WEBIDL_NODE_TYPE_TYPE_ARRAY) != NULL) {
+                *element_type = *base_type;
+                return true;
+        }
+
+        return false;
+}
@@ -21,6 +21,7 @@
 #include "webidl-ast.h"
 #include "ir.h"
 #include "output.h"
+#include "profile.h"
 #include "duk-libdom.h"
 
 /** prefix for all generated functions */
@@ -31,6 +32,8 @@
 
 /**
  * get default value as a string
+ *
+ * The string is a C expression so string literals are quoted.
  */
 static int
 get_member_default_str(struct ir_entry *dictionarye,
@@ -42,6 +45,7 @@ get_member_default_str(struct ir_entry *dictionarye,
         enum webidl_node_type lit_type;
         int *lit_int;
         float *lit_flt;
+        char *lit_str;
 
         lit_node = webidl_node_getnode(
                 webidl_node_find_type(
@@ -78,7 +82,9 @@ get_member_default_str(struct ir_entry *dictionarye,
                 break;
 
         case WEBIDL_NODE_TYPE_LITERAL_STRING:
-                *defl_out = strdup(webidl_node_gettext(lit_node));
+                lit_str = webidl_node_gettext(lit_node);
+                *defl_out = malloc(strlen(lit_str) + 3);
+                sprintf(*defl_out, "\"%s\"", lit_str);
                 break;
 
         case WEBIDL_NODE_TYPE_LITERAL_INT:
@@ -102,6 +108,80 @@ get_member_default_str(struct ir_entry *dictionarye,
 }
 
 
+/**
+ * generate an accessor for a sequence or array dictionary member
+ *
+ * The elements are read with the binding sequence helper and copied to
+ *  an allocation the caller must free, leaving the stack as it was. A
+ *  member which is not present or is empty gives no elements. The
+ *  caller gives the index of the argument holding the dictionary which
+ *  is reported if the member is not a sequence.
+ */
+static int
+output_member_sequence_acessor(struct opctx *outc,
+                               struct ir_entry *dictionarye,
+                               struct ir_operation_argument_entry *membere,
+                               enum webidl_type element_type)
+{
+        const struct sequence_marshal *marshal;
+
+        marshal = get_sequence_marshal(element_type);
+        if (marshal == NULL) {
+                WARN(WARNING_UNIMPLEMENTED,
+                     "Dictionary %s:%s unhandled sequence element type (%d)",
+                     dictionarye->name,
+                     membere->name,
+                     element_type);
+                outputf(outc,
+                        "/* Dictionary %s:%s unhandled sequence element type (%d) */\n\n",
+                        dictionarye->name,
+                        membere->name,
+                        element_type);
+                return 0;
+        }
+
+        outputf(outc,
+                "duk_size_t\n"
+                "%s_%s_get_%s(duk_context *ctx, duk_idx_t idx, int argi, %s**seq_out)\n"
+                "{\n"
+                "\tduk_size_t ret = 0; /* No default */\n"
+                "\tduk_size_t seqi;\n"
+                "\t%s*seq;\n"
+                "\t*seq_out = NULL;\n"
+                "\tidx = duk_normalize_index(ctx, idx);\n"
+                "\t/* ... obj@idx ... */\n"
+                "\t%s_push_key(ctx, %s%s);\n"
+                "\tduk_get_prop(ctx, idx);\n"
+                "\t/* ... obj@idx ... value/undefined */\n"
+                "\tif (!duk_is_undefined(ctx, -1)) {\n"
+                "\t\t/* Note, this throws a duk_error if it's not a sequence */\n"
+                "\t\tret = %s_get_%s_sequence(ctx, -1, argi, \"%s\", &seq);\n"
+                "\t\t/* ... obj@idx ... value elements */\n"
+                "\t\tif (ret > 0) {\n"
+                "\t\t\t*seq_out = malloc(ret * sizeof(*seq));\n"
+                "\t\t\tif (*seq_out == NULL) {\n"
+                "\t\t\t\treturn duk_error(ctx, DUK_ERR_ERROR, \"out of memory\");\n"
+                "\t\t\t}\n"
+                "\t\t}\n"
+                "\t\tfor (seqi = 0; seqi < ret; seqi++) {\n"
+                "\t\t\t(*seq_out)[seqi] = seq[seqi];\n"
+                "\t\t}\n"
+                "\t\tduk_pop(ctx);\n"
+                "\t}\n"
+                "\tduk_pop(ctx);\n"
+                "\t/* ... obj@idx ... */\n"
+                "\treturn ret;\n"
+                "}\n\n",
+                DLPFX, dictionarye->class_name, membere->name,
+                marshal->ctype,
+                marshal->ctype,
+                DLPFX, gen_key_prefix(), membere->name,
+                DLPFX, marshal->name, membere->name);
+
+        return 0;
+}
+
+
 /**
  * generate a single class method for an interface operation
  */
@@ -112,6 +192,7 @@ output_member_acessor(struct opctx *outc,
 {
         struct webidl_node *type_node;
         enum webidl_type *argument_type;
+        enum webidl_type element_type;
         char *defl; /* default for member */
         int res;
 
@@ -141,6 +222,13 @@ output_member_acessor(struct opctx *outc,
                 return -1;
         }
 
+        if (get_sequence_element_type(type_node, &element_type)) {
+                return output_member_sequence_acessor(outc,
+                                                      dictionarye,
+                                                      membere,
+                                                      element_type);
+        }
+
         /* get default text */
         res = get_member_default_str(dictionarye, membere, *argument_type, &defl);
         if (res != 0) {
@@ -161,13 +249,15 @@ output_member_acessor(struct opctx *outc,
                                 "\tconst char *ret = NULL; /* No default */\n");
                 } else {
                         outputf(outc,
-                                "\tconst char *ret = \"%s\"; /* Default value of %s */\n",
+                                "\tconst char *ret = %s; /* Default value of %s */\n",
                                 defl, membere->name);
                 }
 
                 outputf(outc,
+                        "\tidx = duk_normalize_index(ctx, idx);\n"
                         "\t/* ... obj@idx ... */\n"
-                        "\tduk_get_prop_string(ctx, idx, \"%s\");\n"
+                        "\t%s_push_key(ctx, %s%s);\n"
+                        "\tduk_get_prop(ctx, idx);\n"
                         "\t/* ... obj@idx ... value/undefined */\n"
                         "\tif (!duk_is_undefined(ctx, -1)) {\n"
                         "\t\t/* Note, this throws a duk_error if it's not a string */\n"
@@ -176,7 +266,7 @@ output_member_acessor(struct opctx *outc,
                         "\tduk_pop(ctx);\n"
                         "\treturn ret;\n"
                         "}\n\n",
-                        membere->name);
+                        DLPFX, gen_key_prefix(), membere->name);
 
                 break;
 
@@ -197,8 +287,10 @@ output_member_acessor(struct opctx *outc,
                 }
 
                 outputf(outc,
+                        "\tidx = duk_normalize_index(ctx, idx);\n"
                         "\t/* ... obj@idx ... */\n"
-                        "\tduk_get_prop_string(ctx, idx, \"%s\");\n"
+                        "\t%s_push_key(ctx, %s%s);\n"
+                        "\tduk_get_prop(ctx, idx);\n"
                         "\t/* ... obj@idx ... value/undefined */\n"
                         "\tif (!duk_is_undefined(ctx, -1)) {\n"
                         "\t\t/* Note, this throws a duk_error if it's not a boolean */\n"
@@ -207,7 +299,7 @@ output_member_acessor(struct opctx *outc,
                         "\tduk_pop(ctx);\n"
                         "\treturn ret;\n"
                         "}\n\n",
-                        membere->name);
+                        DLPFX, gen_key_prefix(), membere->name);
 
                 break;
 
@@ -230,8 +322,10 @@ output_member_acessor(struct opctx *outc,
                 }
 
                 outputf(outc,
+                        "\tidx = duk_normalize_index(ctx, idx);\n"
                         "\t/* ... obj@idx ... */\n"
-                        "\tduk_get_prop_string(ctx, idx, \"%s\");\n"
+                        "\t%s_push_key(ctx, %s%s);\n"
+                        "\tduk_get_prop(ctx, idx);\n"
                         "\t/* ... obj@idx ... value/undefined */\n"
                         "\tif (!duk_is_undefined(ctx, -1)) {\n"
                         "\t\t/* Note, this throws a duk_error if it's not a int */\n"
@@ -240,7 +334,7 @@ output_member_acessor(struct opctx *outc,
                         "\tduk_pop(ctx);\n"
                         "\treturn ret;\n"
                         "}\n\n",
-                        membere->name);
+                        DLPFX, gen_key_prefix(), membere->name);
                 break;
 
         case WEBIDL_TYPE_FLOAT:
@@ -253,9 +347,11 @@ output_member_acessor(struct opctx *outc,
                 outputf(outc,
                         "{\n"
                         "\tduk_double_t ret = %s; /* Default value of %s */\n"
+                        "\tidx = duk_normalize_index(ctx, idx);\n"
                         "\t/* ... obj@idx ... */\n"
-                        "\tduk_get_prop_string(ctx, idx, \"%s\");\n",
-                        defl, membere->name, membere->name);
+                        "\t%s_push_key(ctx, %s%s);\n"
+                        "\tduk_get_prop(ctx, idx);\n",
+                        defl, membere->name, DLPFX, gen_key_prefix(), membere->name);
 
                 outputf(outc,
                         "\t/* ... obj@idx ... value/undefined */\n"
@@ -288,6 +384,215 @@ output_member_acessor(struct opctx *outc,
         return 0;
 }
 
+/**
+ * get the type of a dictionary member
+ */
+static int
+get_member_type(struct ir_entry *dictionarye,
+                struct ir_operation_argument_entry *membere,
+                struct webidl_node **type_node_out,
+                enum webidl_type *member_type_out)
+{
+        struct webidl_node *type_node;
+        enum webidl_type *member_type;
+
+        type_node = webidl_node_find_type(
+                webidl_node_getnode(membere->node),
+                NULL,
+                WEBIDL_NODE_TYPE_TYPE);
+
+        if (type_node == NULL) {
+                fprintf(stderr, "%s:%s has no type\n",
+                        dictionarye->name,
+                        membere->name);
+                return -1;
+        }
+
+        member_type = (enum webidl_type *)webidl_node_getint(
+                webidl_node_find_type(
+                        webidl_node_getnode(type_node),
+                        NULL,
+                        WEBIDL_NODE_TYPE_TYPE_BASE));
+
+        if (member_type == NULL) {
+                fprintf(stderr,
+                        "%s:%s has no type base\n",
+                        dictionarye->name,
+                        membere->name);
+                return -1;
+        }
+
+        *type_node_out = type_node;
+        *member_type_out = *member_type;
+
+        return 0;
+}
+
+
+/**
+ * get the C type, duktape require call and empty value for a member type
+ *
+ * \return true if the member type can be unpacked else false.
+ */
+static bool
+get_member_unpack(struct webidl_node *type_node,
+                  enum webidl_type member_type,
+                  const char **ctype_out,
+                  const char **require_out,
+                  const char **empty_out)
+{
+        enum webidl_type element_type;
+
+        if (get_sequence_element_type(type_node, &element_type)) {
+                /* sequences are allocated so are read by their accessor */
+                return false;
+        }
+
+        switch (member_type) {
+        case WEBIDL_TYPE_STRING:
+                *ctype_out = "const char *";
+                *require_out = "duk_require_string";
+                *empty_out = "NULL";
+                break;
+
+        case WEBIDL_TYPE_BOOL:
+                *ctype_out = "duk_bool_t ";
+                *require_out = "duk_require_boolean";
+                *empty_out = "false";
+                break;
+
+        case WEBIDL_TYPE_SHORT:
+        case WEBIDL_TYPE_LONG:
+        case WEBIDL_TYPE_LONGLONG:
+                *ctype_out = "duk_int_t ";
+                *require_out = "duk_require_int";
+                *empty_out = "0";
+                break;
+
+        case WEBIDL_TYPE_FLOAT:
+        case WEBIDL_TYPE_DOUBLE:
+                *ctype_out = "duk_double_t ";
+                *require_out = "duk_require_number";
+                *empty_out = "0";
+                break;
+
+        default:
+                return false;
+        }
+
+        return true;
+}
+
+
+/**
+ * generate the unpack function for a dictionary
+ *
+ * All the members, including those of inherited dictionaries, are read
+ *  from the dictionary object in a single pass into the members structure.
+ *  Members not present in the object (or all members if the dictionary is
+ *  not an object) retain their default values.
+ */
+static int
+output_member_unpack(struct opctx *outc,
+                     struct ir *ir,
+                     struct ir_entry *dictionarye)
+{
+        struct ir_entry *inherite;
+        struct ir_operation_argument_entry *membere;
+        struct webidl_node *type_node;
+        enum webidl_type member_type;
+        const char *ctype;
+        const char *require;
+        const char *empty;
+        char *defl;
+        int memberc;
+        int res;
+
+        outputf(outc,
+                "void\n"
+                "%s_%s_unpack(duk_context *ctx, duk_idx_t idx, %s_members_t *out)\n"
+                "{\n"
+                "\tidx = duk_normalize_index(ctx, idx);\n",
+                DLPFX, dictionarye->class_name, dictionarye->class_name);
+
+        inherite = ir_inherit_entry(ir, dictionarye);
+        if (inherite != NULL) {
+                outputf(outc,
+                        "\t%s_%s_unpack(ctx, idx, &out->parent);\n",
+                        DLPFX, inherite->class_name);
+        }
+
+        /* prefill defaults */
+        for (memberc = 0;
+             memberc < dictionarye->u.dictionary.memberc;
+             memberc++) {
+                membere = dictionarye->u.dictionary.memberv + memberc;
+
+                res = get_member_type(dictionarye, membere,
+                                      &type_node, &member_type);
+                if (res != 0) {
+                        return res;
+                }
+                if (!get_member_unpack(type_node, member_type,
+                                       &ctype, &require, &empty)) {
+                        continue;
+                }
+
+                res = get_member_default_str(dictionarye, membere,
+                                             member_type, &defl);
+                if (res != 0) {
+                        return res;
+                }
+
+                if (defl == NULL) {
+                        outputf(outc,
+                                "\tout->%s = %s; /* No default */\n",
+                                membere->name, empty);
+                } else {
+                        outputf(outc,
+                                "\tout->%s = %s; /* Default value of %s */\n",
+                                membere->name, defl, membere->name);
+                        free(defl);
+                }
+        }
+
+        outputf(outc,
+                "\tif (!duk_is_object(ctx, idx)) {\n"
+                "\t\treturn;\n"
+                "\t}\n"
+                "\t/* ... obj@idx ... */\n");
+
+        /* read each member once */
+        for (memberc = 0;
+             memberc < dictionarye->u.dictionary.memberc;
+             memberc++) {
+                membere = dictionarye->u.dictionary.memberv + memberc;
+
+                get_member_type(dictionarye, membere,
+                                &type_node, &member_type);
+                if (!get_member_unpack(type_node, member_type,
+                                       &ctype, &require, &empty)) {
+                        continue;
+                }
+
+                outputf(outc,
+                        "\t%s_push_key(ctx, %s%s);\n"
+                        "\tduk_get_prop(ctx, idx);\n"
+                        "\tif (!duk_is_undefined(ctx, -1)) {\n"
+                        "\t\tout->%s = %s(ctx, -1);\n"
+                        "\t}\n"
+                        "\tduk_pop(ctx);\n",
+                        DLPFX, gen_key_prefix(), membere->name,
+                        membere->name, require);
+        }
+
+        outputf(outc,
+                "}\n\n");
+
+        return 0;
+}
+
+
 static int
 output_member_acessors(struct opctx *outc, struct ir_entry *dictionarye)
 {
@@ -311,42 +616,24 @@ output_member_acessors(struct opctx *outc, struct ir_entry *dictionarye)
 
 
 /* exported function documented in duk-libdom.h */
-int output_dictionary(struct ir *ir, struct ir_entry *dictionarye)
+int output_dictionary(struct duk_libdom_ctx *dlctx,
+                      struct ir *ir,
+                      struct ir_entry *dictionarye)
 {
         struct opctx *dyop;
         int res = 0;
 
         /* open the output */
-        res = output_open(dictionarye->filename, &dyop);
+        res = output_open(dlctx->outdirname,
+                          dictionarye->filename,
+                          dlctx,
+                          &dyop);
         if (res != 0) {
                 return res;
         }
 
-        /* tool preface */
-        output_tool_preface(dyop);
-
-        /* binding preface */
-        output_method_cdata(dyop,
-                            ir->binding_node,
-                            GENBIND_METHOD_TYPE_PREFACE);
-
-        /* class preface */
-        output_method_cdata(dyop,
-                            dictionarye->class,
-                            GENBIND_METHOD_TYPE_PREFACE);
-
-        /* tool prologue */
-        output_tool_prologue(dyop);
-
-        /* binding prologue */
-        output_method_cdata(dyop,
-                            ir->binding_node,
-                            GENBIND_METHOD_TYPE_PROLOGUE);
-
-        /* class prologue */
-        output_method_cdata(dyop,
-                            dictionarye->class,
-                            GENBIND_METHOD_TYPE_PROLOGUE);
+        /* prefaces and prologues */
+        output_source_preamble(dyop, ir, dictionarye);
 
         outputf(dyop, "\n");
 
@@ -355,6 +642,11 @@ int output_dictionary(struct ir *ir, struct ir_entry *dictionarye)
                 goto op_error;
         }
 
+        res = output_member_unpack(dyop, ir, dictionarye);
+        if (res != 0) {
+                goto op_error;
+        }
+
         outputf(dyop, "\n");
 
         /* class epilogue */
@@ -393,6 +685,8 @@ output_member_declaration(struct opctx *outc,
 {
         struct webidl_node *type_node;
         enum webidl_type *argument_type;
+        enum webidl_type element_type;
+        const struct sequence_marshal *marshal;
 
         type_node = webidl_node_find_type(
                 webidl_node_getnode(membere->node),
@@ -420,6 +714,22 @@ output_member_declaration(struct opctx *outc,
                 return -1;
         }
 
+        if (get_sequence_element_type(type_node, &element_type)) {
+                marshal = get_sequence_marshal(element_type);
+                if (marshal == NULL) {
+                        outputf(outc,
+                                "/* Dictionary %s:%s unhandled sequence element type (%d) */\n",
+                                dictionarye->name,
+                                membere->name,
+                                element_type);
+                } else {
+                        outputf(outc,
+                                "duk_size_t %s_%s_get_%s(duk_context *ctx, duk_idx_t idx, int argi, %s**seq_out);\n",
+                                DLPFX, dictionarye->class_name, membere->name,
+                                marshal->ctype);
+                }
+                return 0;
+        }
 
         switch (*argument_type) {
 
@@ -461,13 +771,83 @@ output_member_declaration(struct opctx *outc,
         return 0;
 }
 
+/**
+ * generate the members structure and unpack declaration for a dictionary
+ */
+static int
+output_member_unpack_declaration(struct opctx *outc,
+                                 struct ir *ir,
+                                 struct ir_entry *dictionarye)
+{
+        struct ir_entry *inherite;
+        struct ir_operation_argument_entry *membere;
+        struct webidl_node *type_node;
+        enum webidl_type member_type;
+        const char *ctype;
+        const char *require;
+        const char *empty;
+        int memberc;
+        int res;
+
+        outputf(outc,
+                "/* Unpacked members of %s dictionary */\n"
+                "typedef struct {\n",
+                dictionarye->name);
+
+        inherite = ir_inherit_entry(ir, dictionarye);
+        if (inherite != NULL) {
+                outputf(outc,
+                        "\t%s_members_t parent;\n",
+                        inherite->class_name);
+        }
+
+        for (memberc = 0;
+             memberc < dictionarye->u.dictionary.memberc;
+             memberc++) {
+                membere = dictionarye->u.dictionary.memberv + memberc;
+
+                res = get_member_type(dictionarye, membere,
+                                      &type_node, &member_type);
+                if (res != 0) {
+                        return res;
+                }
+
+                if (get_member_unpack(type_node, member_type,
+                                      &ctype, &require, &empty)) {
+                        outputf(outc, "\t%s%s;\n", ctype, membere->name);
+                } else {
+                        outputf(outc,
+                                "\t/* %s not unpacked (type %d) */\n",
+                                membere->name,
+                                member_type);
+                }
+        }
+
+        outputf(outc,
+                "} %s_members_t;\n",
+                dictionarye->class_name);
+
+        outputf(outc,
+                "void %s_%s_unpack(duk_context *ctx, duk_idx_t idx, %s_members_t *out);\n",
+                DLPFX, dictionarye->class_name, dictionarye->class_name);
+
+        return 0;
+}
+
 /* exported function documented in duk-libdom.h */
 int
-output_dictionary_declaration(struct opctx *outc, struct ir_entry *dictionarye)
+output_dictionary_declaration(struct opctx *outc,
+                              struct ir *ir,
+                              struct ir_entry *dictionarye)
 {
         int memberc;
         int res = 0;
 
+        res = output_member_unpack_declaration(outc, ir, dictionarye);
+        if (res != 0) {
+                return res;
+        }
+
         for (memberc = 0;
              memberc < dictionarye->u.dictionary.memberc;
              memberc++) {
@@ -27,6 +27,7 @@
 #include "webidl-ast.h"
 #include "ir.h"
 #include "output.h"
+#include "profile.h"
 #include "duk-libdom.h"
 
 static int
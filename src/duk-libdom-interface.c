@@ -21,6 +21,7 @@
 #include "webidl-ast.h"
 #include "ir.h"
 #include "output.h"
+#include "profile.h"
 #include "duk-libdom.h"
 
 /** prefix for all generated functions */
@@ -224,23 +225,132 @@ output_dump_stack(struct opctx *outc)
 }
 
 
+/**
+ * test if an operation uses the shared unimplemented stub
+ */
+static bool operation_stubbed(struct ir_operation_entry *operatione)
+{
+        return (options->sharedstubs &&
+                (operatione->name != NULL) &&
+                (operatione->method == NULL));
+}
+
+
+/**
+ * test if an attribute getter uses the shared unimplemented stub
+ *
+ * A putforwards setter calls the getter directly so it is always
+ *  generated for them.
+ */
+static bool getter_stubbed(struct ir_attribute_entry *atributee)
+{
+        return (options->sharedstubs &&
+                (atributee->getter == NULL) &&
+                (atributee->putforwards == NULL));
+}
+
+
+/**
+ * test if an attribute setter uses the shared unimplemented stub
+ */
+static bool setter_stubbed(struct ir_attribute_entry *atributee)
+{
+        return (options->sharedstubs &&
+                (atributee->setter == NULL) &&
+                (atributee->putforwards == NULL));
+}
+
+
+/**
+ * generate code that pushes the function of a member
+ */
+static int
+output_push_member_function(struct opctx *outc,
+                            struct ir_entry *interfacee,
+                            const char *kind,
+                            const char *member,
+                            const char *suffix,
+                            const char *nargs,
+                            bool stubbed)
+{
+        if (stubbed) {
+                outputf(outc,
+                        "\tduk_push_c_function(ctx, %s_unimplemented, %s);\n",
+                        DLPFX, nargs);
+                return output_unimplemented_magic(outc,
+                                                  interfacee,
+                                                  kind,
+                                                  member);
+        }
+
+        outputf(outc,
+                "\tduk_push_c_function(ctx, %s_%s_%s%s, %s);\n",
+                DLPFX, interfacee->class_name, member, suffix, nargs);
+
+        return 0;
+}
+
+
+/**
+ * generate code that pushes the getter or setter function of an attribute
+ *
+ * Reflected attributes use the shared reflect accessors with their
+ *  magic selecting the content attribute.
+ */
+static int
+output_push_attribute_function(struct opctx *outc,
+                               struct ir_entry *interfacee,
+                               struct ir_attribute_entry *atributee,
+                               const char *kind,
+                               const char *suffix,
+                               const char *nargs,
+                               bool stubbed)
+{
+        if (atributee->reflect_magic != 0) {
+                outputf(outc,
+                        "\tduk_push_c_function(ctx, %s_reflect_%s_%s, %s);\n",
+                        DLPFX,
+                        (atributee->typev[0].base == WEBIDL_TYPE_BOOL) ?
+                        "bool" : "string",
+                        kind,
+                        nargs);
+                outputf(outc,
+                        "\tduk_set_magic(ctx, -1, %d);\n",
+                        atributee->reflect_magic);
+                return 0;
+        }
+
+        return output_push_member_function(outc,
+                                           interfacee,
+                                           kind,
+                                           atributee->name,
+                                           suffix,
+                                           nargs,
+                                           stubbed);
+}
+
+
 /**
  * generate code that adds a method in a prototype
  */
 static int
 output_add_method(struct opctx *outc,
-                  const char *class_name,
-                  const char *method)
+                  struct ir_entry *interfacee,
+                  struct ir_operation_entry *operatione)
 {
         outputf(outc,
                 "\t/* Add a method */\n");
         outputf(outc,
                 "\tduk_dup(ctx, 0);\n");
         outputf(outc,
-                "\tduk_push_string(ctx, \"%s\");\n", method);
-        outputf(outc,
-                "\tduk_push_c_function(ctx, %s_%s_%s, DUK_VARARGS);\n",
-                DLPFX, class_name, method);
+                "\tduk_push_string(ctx, \"%s\");\n", operatione->name);
+        output_push_member_function(outc,
+                                    interfacee,
+                                    "method",
+                                    operatione->name,
+                                    "",
+                                    "DUK_VARARGS",
+                                    operation_stubbed(operatione));
         output_dump_stack(outc);
         outputf(outc,
                 "\tduk_def_prop(ctx, -3,\n");
@@ -265,21 +375,29 @@ output_add_method(struct opctx *outc,
  */
 static int
 output_populate_rw_property(struct opctx *outc,
-                            const char *class_name,
-                            const char *property)
+                            struct ir_entry *interfacee,
+                            struct ir_attribute_entry *atributee)
 {
         outputf(outc,
                 "\t/* Add read/write property */\n");
         outputf(outc,
                 "\tduk_dup(ctx, 0);\n");
         outputf(outc,
-                "\tduk_push_string(ctx, \"%s\");\n", property);
-        outputf(outc,
-                "\tduk_push_c_function(ctx, %s_%s_%s_getter, 0);\n",
-                DLPFX, class_name, property);
-        outputf(outc,
-                "\tduk_push_c_function(ctx, %s_%s_%s_setter, 1);\n",
-                DLPFX, class_name, property);
+                "\tduk_push_string(ctx, \"%s\");\n", atributee->name);
+        output_push_attribute_function(outc,
+                                       interfacee,
+                                       atributee,
+                                       "getter",
+                                       "_getter",
+                                       "0",
+                                       getter_stubbed(atributee));
+        output_push_attribute_function(outc,
+                                       interfacee,
+                                       atributee,
+                                       "setter",
+                                       "_setter",
+                                       "1",
+                                       setter_stubbed(atributee));
         output_dump_stack(outc);
         outputf(outc,
                 "\tduk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |\n");
@@ -301,18 +419,22 @@ output_populate_rw_property(struct opctx *outc,
  */
 static int
 output_populate_ro_property(struct opctx *outc,
-                            const char *class_name,
-                            const char *property)
+                            struct ir_entry *interfacee,
+                            struct ir_attribute_entry *atributee)
 {
         outputf(outc,
                 "\t/* Add readonly property */\n");
         outputf(outc,
                 "\tduk_dup(ctx, 0);\n");
         outputf(outc,
-                "\tduk_push_string(ctx, \"%s\");\n", property);
-        outputf(outc,
-                "\tduk_push_c_function(ctx, %s_%s_%s_getter, 0);\n",
-                DLPFX, class_name, property);
+                "\tduk_push_string(ctx, \"%s\");\n", atributee->name);
+        output_push_attribute_function(outc,
+                                       interfacee,
+                                       atributee,
+                                       "getter",
+                                       "_getter",
+                                       "0",
+                                       getter_stubbed(atributee));
         output_dump_stack(outc);
         outputf(outc,
                 "\tduk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |\n");
@@ -403,14 +525,21 @@ static int
 output_interface_constructor(struct opctx *outc, struct ir_entry *interfacee)
 {
         int init_argc;
+        int res;
 
         /* constructor definition */
+        output_member_placement(outc, interfacee, "constructor", NULL, true);
         outputf(outc,
                 "static duk_ret_t %s_%s___constructor(duk_context *ctx)\n",
                 DLPFX, interfacee->class_name);
         outputf(outc,
                 "{\n");
 
+        res = output_profile_entry(outc, interfacee, "constructor", NULL);
+        if (res != 0) {
+                return res;
+        }
+
         output_create_private(outc, interfacee->class_name);
 
         /* generate call to initialisor */
@@ -444,13 +573,21 @@ output_interface_constructor(struct opctx *outc, struct ir_entry *interfacee)
 static int
 output_interface_destructor(struct opctx *outc, struct ir_entry *interfacee)
 {
+        int res;
+
         /* destructor definition */
+        output_member_placement(outc, interfacee, "finaliser", NULL, true);
         outputf(outc,
                 "static duk_ret_t %s_%s___destructor(duk_context *ctx)\n",
                 DLPFX, interfacee->class_name);
         outputf(outc,
                 "{\n");
 
+        res = output_profile_entry(outc, interfacee, "finaliser", NULL);
+        if (res != 0) {
+                return res;
+        }
+
         output_safe_get_private(outc, interfacee->class_name, 0);
 
         /* generate call to finaliser */
@@ -558,6 +695,343 @@ output_interface_inherit_init(struct opctx *outc,
 }
 
 
+/**
+ * get the code of a class method
+ *
+ * \return The code without leading whitespace or NULL if there is none.
+ */
+static const char *
+method_code(struct genbind_node *class, enum genbind_method_type method_type)
+{
+        struct genbind_node *method_node;
+        const char *cdata;
+
+        method_node = genbind_node_find_method(class, NULL, method_type);
+        cdata = genbind_node_gettext(
+                genbind_node_find_type(
+                        genbind_node_getnode(method_node),
+                        NULL,
+                        GENBIND_NODE_TYPE_CDATA));
+        if (cdata == NULL) {
+                return NULL;
+        }
+
+        cdata += strspn(cdata, " \t\r\n");
+        if (*cdata == 0) {
+                return NULL;
+        }
+
+        return cdata;
+}
+
+/**
+ * test if an interface or its ancestors have code for a class method
+ */
+static bool
+chain_has_method_code(struct ir *ir,
+                      struct ir_entry *interfacee,
+                      enum genbind_method_type method_type)
+{
+        while (interfacee != NULL) {
+                if (method_code(interfacee->class, method_type) != NULL) {
+                        return true;
+                }
+
+                interfacee = ir_inherit_entry(ir, interfacee);
+        }
+
+        return false;
+}
+
+/**
+ * test if the code of an ancestor class method can be placed inline
+ *
+ * The code is compiled in the descendant source so cannot be placed if
+ *  the class has a preface or prologue it may rely on, nor if it may
+ *  return early as that would leave the whole descendant method. Any
+ *  return identifier counts, even in a comment or string, as the code
+ *  is not parsed.
+ */
+static bool
+flat_placeable(struct ir_entry *inherite, enum genbind_method_type method_type)
+{
+        const char *reason = NULL;
+        const char *cdata;
+        size_t len;
+
+        if ((method_code(inherite->class,
+                         GENBIND_METHOD_TYPE_PREFACE) != NULL) ||
+            (method_code(inherite->class,
+                         GENBIND_METHOD_TYPE_PROLOGUE) != NULL)) {
+                reason = "has a preface or prologue";
+        }
+
+        cdata = method_code(inherite->class, method_type);
+        while ((reason == NULL) && (cdata != NULL) && (*cdata != 0)) {
+                len = strspn(cdata,
+                             "abcdefghijklmnopqrstuvwxyz"
+                             "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                             "0123456789_");
+                if (len == 0) {
+                        cdata++;
+                } else if ((len == 6) && (strncmp(cdata, "return", 6) == 0)) {
+                        reason = "may return early";
+                } else {
+                        cdata += len;
+                }
+        }
+
+        if (reason == NULL) {
+                return true;
+        }
+
+        if (options->verbose) {
+                printf("Calling class %s %s as it %s\n",
+                       inherite->class_name,
+                       (method_type == GENBIND_METHOD_TYPE_INIT) ?
+                       "initialiser" : "finaliser",
+                       reason);
+        }
+
+        return false;
+}
+
+/**
+ * output a declaration of a parameter with a prefixed identifier
+ */
+static void
+output_prefixed_param(struct opctx *outc,
+                      struct genbind_node *param_node,
+                      const char *prefix)
+{
+        struct genbind_node *name_node;
+        const char *type_cdata = NULL;
+
+        name_node = genbind_node_find_type(genbind_node_getnode(param_node),
+                                           NULL,
+                                           GENBIND_NODE_TYPE_NAME);
+        while (name_node != NULL) {
+                type_cdata = genbind_node_gettext(name_node);
+                name_node = genbind_node_find_type(
+                        genbind_node_getnode(param_node),
+                        name_node,
+                        GENBIND_NODE_TYPE_NAME);
+        }
+
+        output_ctype(outc, param_node, false);
+        if ((type_cdata != NULL) && (type_cdata[0] != '*')) {
+                outputc(outc, ' ');
+        }
+        outputf(outc, "%s", prefix);
+        output_cdata(outc, param_node, GENBIND_NODE_TYPE_IDENT);
+}
+
+/**
+ * generate the parent interface initialisor code inline
+ *
+ * The parent private and initialisor parameters are bound from those of
+ *  the interface in a new scope where the ancestors of the parent are
+ *  placed inline before the parent initialisor code. Temporaries hold
+ *  the bound values as the parent identifiers may shadow those they are
+ *  bound from. A parent whose code cannot be placed is called instead.
+ */
+static int
+output_interface_flat_init(struct opctx *outc,
+                           struct ir *ir,
+                           struct ir_entry *interfacee,
+                           struct ir_entry *inherite)
+{
+        struct genbind_node *init_node;
+        struct genbind_node *inh_init_node;
+        struct genbind_node *param_node;
+        struct genbind_node *inh_param_node;
+        char *param_name;
+        int res;
+
+        /* ancestors without initialisor code need not be placed */
+        if (!chain_has_method_code(ir, inherite, GENBIND_METHOD_TYPE_INIT)) {
+                return 0;
+        }
+
+        if (!flat_placeable(inherite, GENBIND_METHOD_TYPE_INIT)) {
+                return output_interface_inherit_init(outc,
+                                                     interfacee,
+                                                     inherite);
+        }
+
+        init_node = genbind_node_find_method(interfacee->class,
+                                             NULL,
+                                             GENBIND_METHOD_TYPE_INIT);
+
+        inh_init_node = genbind_node_find_method(inherite->class,
+                                                 NULL,
+                                                 GENBIND_METHOD_TYPE_INIT);
+
+        outputf(outc, "\t/* %s initialiser */\n", inherite->name);
+        outputf(outc, "\t{\n");
+        outputf(outc,
+                "\t%s_private_t *%s_parent_priv = &priv->parent;\n",
+                inherite->class_name, DLPFX);
+
+        /* bind each parent parameter from a matching named parameter */
+        inh_param_node = genbind_node_find_type(
+                genbind_node_getnode(inh_init_node),
+                NULL, GENBIND_NODE_TYPE_PARAMETER);
+        while (inh_param_node != NULL) {
+                param_name = genbind_node_gettext(
+                        genbind_node_find_type(
+                                genbind_node_getnode(inh_param_node),
+                                NULL,
+                                GENBIND_NODE_TYPE_IDENT));
+
+                param_node = genbind_node_find_type_ident(
+                        genbind_node_getnode(init_node),
+                        NULL,
+                        GENBIND_NODE_TYPE_PARAMETER,
+                        param_name);
+                if (param_node == NULL) {
+                        fprintf(stderr,
+                                "class \"%s\" (interface %s) parent class \"%s\" (interface %s) initialisor requires a parameter \"%s\" with compatible identifier\n",
+                                interfacee->class_name,
+                                interfacee->name,
+                                inherite->class_name,
+                                inherite->name,
+                                param_name);
+                        return -1;
+                }
+
+                outputc(outc, '\t');
+                output_prefixed_param(outc, inh_param_node, DLPFX "_parent_");
+                outputf(outc, " = ");
+
+                /* cast the parameter if required */
+                if (compare_ctypes(param_node, inh_param_node) == false) {
+                        outputc(outc, '(');
+                        output_ctype(outc, inh_param_node, false);
+                        outputc(outc, ')');
+                }
+                output_cdata(outc, param_node, GENBIND_NODE_TYPE_IDENT);
+                outputf(outc, ";\n");
+
+                inh_param_node = genbind_node_find_type(
+                        genbind_node_getnode(inh_init_node),
+                        inh_param_node, GENBIND_NODE_TYPE_PARAMETER);
+        }
+
+        /* rebind the parent values to the identifiers its code uses */
+        outputf(outc, "\t{\n");
+        outputf(outc,
+                "\t%s_private_t *priv = %s_parent_priv;\n",
+                inherite->class_name, DLPFX);
+
+        inh_param_node = genbind_node_find_type(
+                genbind_node_getnode(inh_init_node),
+                NULL, GENBIND_NODE_TYPE_PARAMETER);
+        while (inh_param_node != NULL) {
+                outputc(outc, '\t');
+                output_ctype(outc, inh_param_node, true);
+                outputf(outc, " = %s_parent_", DLPFX);
+                output_cdata(outc, inh_param_node, GENBIND_NODE_TYPE_IDENT);
+                outputf(outc, ";\n");
+
+                inh_param_node = genbind_node_find_type(
+                        genbind_node_getnode(inh_init_node),
+                        inh_param_node, GENBIND_NODE_TYPE_PARAMETER);
+        }
+
+        res = output_interface_flat_init(outc,
+                                         ir,
+                                         inherite,
+                                         ir_inherit_entry(ir, inherite));
+        if (res != 0) {
+                return res;
+        }
+
+        /* output the parent initaliser code from the binding */
+        output_ccode(outc, inh_init_node);
+
+        outputf(outc, "\t}\n");
+        outputf(outc, "\t}\n");
+
+        return 0;
+}
+
+/**
+ * output the address of an ancestor private nested depth parents down
+ */
+static void
+output_parent_priv(struct opctx *outc, unsigned int depth)
+{
+        outputf(outc, "&priv->parent");
+        while (depth-- > 0) {
+                outputf(outc, ".parent");
+        }
+}
+
+/**
+ * generate the parent interface finaliser code inline
+ *
+ * The parent private is bound in a new scope where the parent
+ *  finaliser code is placed followed by that of its ancestors. A parent
+ *  without finaliser code of its own is passed over, depth counting the
+ *  parents nested between the private and that of the ancestor. A parent
+ *  whose code cannot be placed is called instead.
+ */
+static int
+output_interface_flat_fini(struct opctx *outc,
+                           struct ir *ir,
+                           struct ir_entry *inherite,
+                           unsigned int depth)
+{
+        struct genbind_node *inh_fini_node;
+
+        /* ancestors without finaliser code need not be placed */
+        if (!chain_has_method_code(ir, inherite, GENBIND_METHOD_TYPE_FINI)) {
+                return 0;
+        }
+
+        if (method_code(inherite->class, GENBIND_METHOD_TYPE_FINI) == NULL) {
+                return output_interface_flat_fini(
+                        outc, ir, ir_inherit_entry(ir, inherite), depth + 1);
+        }
+
+        if (!flat_placeable(inherite, GENBIND_METHOD_TYPE_FINI)) {
+                outputf(outc,
+                        "\t%s_%s___fini(ctx, ",
+                        DLPFX, inherite->class_name);
+                output_parent_priv(outc, depth);
+                outputf(outc, ");\n");
+                return 0;
+        }
+
+        inh_fini_node = genbind_node_find_method(inherite->class,
+                                                 NULL,
+                                                 GENBIND_METHOD_TYPE_FINI);
+
+        outputf(outc, "\t/* %s finaliser */\n", inherite->name);
+        outputf(outc, "\t{\n");
+        outputf(outc,
+                "\t%s_private_t *%s_parent_priv = ",
+                inherite->class_name, DLPFX);
+        output_parent_priv(outc, depth);
+        outputf(outc, ";\n");
+        outputf(outc, "\t{\n");
+        outputf(outc,
+                "\t%s_private_t *priv = %s_parent_priv;\n",
+                inherite->class_name, DLPFX);
+
+        /* output the parent finialisor code from the binding */
+        output_cdata(outc, inh_fini_node, GENBIND_NODE_TYPE_CDATA);
+
+        output_interface_flat_fini(outc, ir, ir_inherit_entry(ir, inherite), 0);
+
+        outputf(outc, "\t}\n");
+        outputf(outc, "\t}\n");
+
+        return 0;
+}
+
+
 static int
 output_interface_init_declaration(struct opctx *outc,
                                   struct ir_entry *interfacee,
@@ -602,6 +1076,7 @@ output_interface_init_declaration(struct opctx *outc,
  */
 static int
 output_interface_init(struct opctx *outc,
+                      struct ir *ir,
                       struct ir_entry *interfacee,
                       struct ir_entry *inherite)
 {
@@ -618,8 +1093,12 @@ output_interface_init(struct opctx *outc,
 
         outputf(outc, "\n{\n");
 
-        /* if this interface inherits ensure we call its initialisor */
-        res = output_interface_inherit_init(outc, interfacee, inherite);
+        /* if this interface inherits ensure its parent is initialised */
+        if (options->flatinit) {
+                res = output_interface_flat_init(outc, ir, interfacee, inherite);
+        } else {
+                res = output_interface_inherit_init(outc, interfacee, inherite);
+        }
         if (res != 0) {
                 return res;
         }
@@ -645,6 +1124,7 @@ output_interface_init(struct opctx *outc,
  */
 static int
 output_interface_fini(struct opctx *outc,
+                      struct ir *ir,
                       struct ir_entry *interfacee,
                       struct ir_entry *inherite)
 {
@@ -673,8 +1153,10 @@ output_interface_fini(struct opctx *outc,
         /* output the finialisor code from the binding */
         output_cdata(outc, fini_node, GENBIND_NODE_TYPE_CDATA);
 
-        /* if this interface inherits ensure we call its finaliser */
-        if (inherite != NULL) {
+        /* if this interface inherits ensure its parent is finalised */
+        if (options->flatinit) {
+                output_interface_flat_fini(outc, ir, inherite, 0);
+        } else if (inherite != NULL) {
                 outputf(outc,
                         "\t%s_%s___fini(ctx, &priv->parent);\n",
                         DLPFX, inherite->class_name);
@@ -696,9 +1178,7 @@ output_prototype_method(struct opctx *outc,
 
         if (operatione->name != NULL) {
                 /* normal method on prototype */
-                output_add_method(outc,
-                                  interfacee->class_name,
-                                  operatione->name);
+                output_add_method(outc, interfacee, operatione);
         } else {
                 /* special method on prototype */
                 outputf(outc,
@@ -740,12 +1220,12 @@ output_prototype_attribute(struct opctx *outc,
     if ((attributee->putforwards == NULL) &&
         (attributee->modifier == WEBIDL_TYPE_MODIFIER_READONLY)) {
                 return output_populate_ro_property(outc,
-                                                   interfacee->class_name,
-                                                   attributee->name);
+                                                   interfacee,
+                                                   attributee);
         }
         return output_populate_rw_property(outc,
-                                           interfacee->class_name,
-                                           attributee->name);
+                                           interfacee,
+                                           attributee);
 }
 
 
@@ -927,34 +1407,41 @@ output_interface_prototype(struct opctx *outc,
 
 
 /**
- * generate a single class method for an interface operation with elipsis
+ * generate a single class method for an interface overloaded operation
  */
 static int
-output_interface_elipsis_operation(struct opctx *outc,
-                                   struct ir_entry *interfacee,
-                                   struct ir_operation_entry *operatione)
+output_interface_overloaded_operation(struct opctx *outc,
+                                      struct ir_entry *interfacee,
+                                      struct ir_operation_entry *operatione)
 {
         int cdatac; /* cdata blocks output */
+        int res;
 
         /* overloaded method definition */
+        output_member_placement(outc, interfacee, "method", operatione->name,
+                                operatione->method != NULL);
         outputf(outc,
                 "static duk_ret_t %s_%s_%s(duk_context *ctx)\n",
                 DLPFX, interfacee->class_name, operatione->name);
         outputf(outc,
                 "{\n");
 
-        /**
-         * \todo This is where the checking of the parameters to the
-         * operation with elipsis should go
+        res = output_profile_entry(outc, interfacee, "method", operatione->name);
+        if (res != 0) {
+                return res;
+        }
+
+        /** \todo This is where the checking of the parameters to the
+         * overloaded operation should go
          */
-        WARN(WARNING_UNIMPLEMENTED,
-             "Elipsis parameters not checked: method %s::%s();",
-                     interfacee->name, operatione->name);
 
         output_get_method_private(outc, interfacee->class_name,
                                   interfacee->u.interface.primary_global);
 
-        cdatac = output_ccode(outc, operatione->method);
+        cdatac = output_cdata(outc,
+                              operatione->method,
+                              GENBIND_NODE_TYPE_CDATA);
+
         if (cdatac == 0) {
                 /* no implementation so generate default */
                 WARN(WARNING_UNIMPLEMENTED,
@@ -972,137 +1459,215 @@ output_interface_elipsis_operation(struct opctx *outc,
 
 
 /**
- * generate a single class method for an interface overloaded operation
+ * generate a single class method for an interface special operation
  */
 static int
-output_interface_overloaded_operation(struct opctx *outc,
-                                      struct ir_entry *interfacee,
-                                      struct ir_operation_entry *operatione)
+output_interface_special_operation(struct opctx *outc,
+                                   struct ir_entry *interfacee,
+                                   struct ir_operation_entry *operatione)
 {
-        int cdatac; /* cdata blocks output */
-
-        /* overloaded method definition */
-        outputf(outc,
-                "static duk_ret_t %s_%s_%s(duk_context *ctx)\n",
-                DLPFX, interfacee->class_name, operatione->name);
+        /* special method definition */
         outputf(outc,
-                "{\n");
+                "/* Special method definition - UNIMPLEMENTED */\n\n");
 
-        /** \todo This is where the checking of the parameters to the
-         * overloaded operation should go
-         */
+        WARN(WARNING_UNIMPLEMENTED,
+             "Special operation on interface %s (operation entry %p)",
+             interfacee->name,
+             operatione);
 
-        output_get_method_private(outc, interfacee->class_name,
-                                  interfacee->u.interface.primary_global);
+        return 0;
+}
 
-        cdatac = output_cdata(outc,
-                              operatione->method,
-                              GENBIND_NODE_TYPE_CDATA);
 
-        if (cdatac == 0) {
-                /* no implementation so generate default */
-                WARN(WARNING_UNIMPLEMENTED,
-                     "Unimplemented: method %s::%s();",
-                     interfacee->name, operatione->name);
-                outputf(outc,
-                        "\treturn 0;\n");
+/**
+ * get the literal default value of an optional argument
+ *
+ * \param argumente The argument to examine.
+ * \return The literal node or NULL if the default is undefined.
+ */
+static struct webidl_node *
+get_optional_default(struct ir_operation_argument_entry *argumente)
+{
+        struct webidl_node *lit_node; /* literal node */
+
+        lit_node = webidl_node_getnode(
+                webidl_node_find_type(
+                        webidl_node_getnode(argumente->node),
+                        NULL,
+                        WEBIDL_NODE_TYPE_OPTIONAL));
+        if (lit_node == NULL) {
+                return NULL;
         }
 
-        outputf(outc,
-                "}\n\n");
+        switch (webidl_node_gettype(lit_node)) {
+        case WEBIDL_NODE_TYPE_LITERAL_NULL:
+        case WEBIDL_NODE_TYPE_LITERAL_INT:
+        case WEBIDL_NODE_TYPE_LITERAL_BOOL:
+        case WEBIDL_NODE_TYPE_LITERAL_STRING:
+                return lit_node;
 
-        return 0;
+        case WEBIDL_NODE_TYPE_LITERAL_FLOAT:
+        default:
+                break;
+        }
+        return NULL;
 }
 
 
 /**
- * generate a single class method for an interface special operation
+ * generate default value of an optional argument on the duk stack
  */
 static int
-output_interface_special_operation(struct opctx *outc,
-                                   struct ir_entry *interfacee,
-                                   struct ir_operation_entry *operatione)
+output_operation_optional_default(
+        struct opctx *outc,
+        struct ir_operation_argument_entry *argumente)
 {
-        /* special method definition */
-        outputf(outc,
-                "/* Special method definition - UNIMPLEMENTED */\n\n");
+        struct webidl_node *lit_node; /* literal node */
+        int *lit_int;
+        char *lit_str;
 
-        WARN(WARNING_UNIMPLEMENTED,
-             "Special operation on interface %s (operation entry %p)",
-             interfacee->name,
-             operatione);
+        lit_node = get_optional_default(argumente);
+        if (lit_node == NULL) {
+                outputf(outc,
+                        "\t\tduk_push_undefined(ctx);\n");
+                return 0;
+        }
+
+        switch (webidl_node_gettype(lit_node)) {
+        case WEBIDL_NODE_TYPE_LITERAL_NULL:
+                outputf(outc,
+                        "\t\tduk_push_null(ctx);\n");
+                break;
+
+        case WEBIDL_NODE_TYPE_LITERAL_INT:
+                lit_int = webidl_node_getint(lit_node);
+                outputf(outc,
+                        "\t\tduk_push_int(ctx, %d);\n",
+                        *lit_int);
+                break;
+
+        case WEBIDL_NODE_TYPE_LITERAL_BOOL:
+                lit_int = webidl_node_getint(lit_node);
+                outputf(outc,
+                        "\t\tduk_push_boolean(ctx, %d);\n",
+                        *lit_int);
+                break;
 
+        case WEBIDL_NODE_TYPE_LITERAL_STRING:
+                lit_str = webidl_node_gettext(lit_node);
+                outputf(outc,
+                        "\t\tduk_push_string(ctx, \"%s\");\n",
+                        lit_str);
+                break;
+
+        default:
+                break;
+        }
         return 0;
 }
 
 
 /**
- * generate default values on the duk stack
+ * generate argument count check and defaults for optional arguments
+ *
+ * Missing optional arguments are pushed by a switch on the argument count
+ *  which falls through so each default is pushed once. When every default
+ *  is undefined setting the stack top is sufficient.
+ *
+ * \param outc The output context.
+ * \param overloade The overload to generate the check for.
+ * \param argumentc The number of named (non variadic) arguments.
+ * \param variadic Extra arguments are variadic and must not be removed.
  */
 static int
-output_operation_optional_defaults(
-        struct opctx *outc,
-        struct ir_operation_argument_entry *argumentv,
-        int argumentc)
+output_operation_argument_count(struct opctx *outc,
+                                struct ir_operation_overload_entry *overloade,
+                                int argumentc,
+                                bool variadic)
 {
-        int argc;
-        for (argc = 0; argc < argumentc; argc++) {
-                struct ir_operation_argument_entry *cure;
-                struct webidl_node *lit_node; /* literal node */
-                enum webidl_node_type lit_type;
-                int *lit_int;
-                char *lit_str;
-
-                cure = argumentv + argc;
-
-                lit_node = webidl_node_getnode(
-                        webidl_node_find_type(
-                                webidl_node_getnode(cure->node),
-                                NULL,
-                                WEBIDL_NODE_TYPE_OPTIONAL));
+        int fixedargc; /* number of non optional arguments */
+        int optargc; /* loop counter for optional arguments */
+        bool defaults = false; /* any default is not undefined */
 
-                if (lit_node != NULL) {
+        fixedargc = argumentc - overloade->optionalc;
 
-                        lit_type = webidl_node_gettype(lit_node);
+        outputf(outc,
+                "\t/* ensure the parameters are present */\n"
+                "\tduk_idx_t %s_argc = duk_get_top(ctx);\n", DLPFX);
 
-                        switch (lit_type) {
-                        case WEBIDL_NODE_TYPE_LITERAL_NULL:
-                                outputf(outc,
-                                        "\t\tduk_push_null(ctx);\n");
-                                break;
+        if (fixedargc > 0) {
+                outputf(outc,
+                        "\tif (%s_argc < %d) {\n",
+                        DLPFX, fixedargc);
+                outputf(outc,
+                        "\t\t/* not enough arguments */\n");
+                outputf(outc,
+                        "\t\treturn duk_error(ctx, DUK_RET_TYPE_ERROR, %s_error_fmt_argument, %d, %s_argc);\n",
+                        DLPFX, fixedargc, DLPFX);
+                outputf(outc,
+                        "\t}\n");
+        }
 
-                        case WEBIDL_NODE_TYPE_LITERAL_INT:
-                                lit_int = webidl_node_getint(lit_node);
-                                outputf(outc,
-                                        "\t\tduk_push_int(ctx, %d);\n",
-                                        *lit_int);
-                                break;
+        for (optargc = fixedargc; optargc < argumentc; optargc++) {
+                if (get_optional_default(overloade->argumentv + optargc) != NULL) {
+                        defaults = true;
+                        break;
+                }
+        }
 
-                        case WEBIDL_NODE_TYPE_LITERAL_BOOL:
-                                lit_int = webidl_node_getint(lit_node);
-                                outputf(outc,
-                                        "\t\tduk_push_boolean(ctx, %d);\n",
-                                        *lit_int);
-                                break;
+        if (!defaults) {
+                if (!variadic) {
+                        /* missing arguments are undefined and extras removed */
+                        outputf(outc,
+                                "\tduk_set_top(ctx, %d);\n",
+                                argumentc);
+                } else if (argumentc > fixedargc) {
+                        /* missing arguments are undefined */
+                        outputf(outc,
+                                "\tif (%s_argc < %d) {\n"
+                                "\t\tduk_set_top(ctx, %d);\n"
+                                "\t}\n",
+                                DLPFX, argumentc, argumentc);
+                }
+                outputf(outc, "\n");
+                return 0;
+        }
 
-                        case WEBIDL_NODE_TYPE_LITERAL_STRING:
-                                lit_str = webidl_node_gettext(lit_node);
-                                outputf(outc,
-                                        "\t\tduk_push_string(ctx, \"%s\");\n",
-                                        lit_str);
-                                break;
+        outputf(outc,
+                "\tswitch (%s_argc) {\n",
+                DLPFX);
 
-                        case WEBIDL_NODE_TYPE_LITERAL_FLOAT:
-                        default:
-                                outputf(outc,
-                                        "\t\tduk_push_undefined(ctx);\n");
-                                break;
-                        }
+        for (optargc = fixedargc; optargc < argumentc; optargc++) {
+                outputf(outc,
+                        "\tcase %d:\n",
+                        optargc);
+                output_operation_optional_default(outc,
+                        overloade->argumentv + optargc);
+                if ((optargc + 1) < argumentc) {
+                        outputf(outc,
+                                "\t\t/* fallthrough */\n");
                 } else {
                         outputf(outc,
-                                "\t\tduk_push_undefined(ctx);\n");
+                                "\t\tbreak;\n");
                 }
         }
+
+        if (variadic) {
+                outputf(outc,
+                        "\tdefault:\n"
+                        "\t\tbreak;\n"
+                        "\t}\n"
+                        "\n");
+        } else {
+                outputf(outc,
+                        "\tdefault:\n"
+                        "\t\t/* remove extraneous parameters */\n"
+                        "\t\tduk_set_top(ctx, %d);\n"
+                        "\t}\n"
+                        "\n",
+                        argumentc);
+        }
+
         return 0;
 }
 
@@ -1118,6 +1683,7 @@ output_operation_argument_type_check(
         struct ir_operation_argument_entry *argumente;
         struct webidl_node *type_node;
         enum webidl_type *argument_type;
+        enum webidl_type element_type;
 
         argumente = overloade->argumentv + argidx;
 
@@ -1159,6 +1725,17 @@ output_operation_argument_type_check(
         outputf(outc,
                 "\tif (%s_argc > %d) {\n", DLPFX, argidx);
 
+        if (get_sequence_element_type(type_node, &element_type)) {
+                /* elements are checked when the sequence is read */
+                outputf(outc,
+                        "\t\tif (!duk_is_array(ctx, %d)) {\n"
+                        "\t\t\treturn duk_error(ctx, DUK_ERR_ERROR, %s_error_fmt_sequence_type, %d, \"%s\");\n"
+                        "\t\t}\n"
+                        "\t}\n",
+                        argidx, DLPFX, argidx, argumente->name);
+                return 0;
+        }
+
         switch (*argument_type) {
         case WEBIDL_TYPE_STRING:
                 /* coerce values to string */
@@ -1200,6 +1777,168 @@ output_operation_argument_type_check(
 }
 
 
+/**
+ * generate a single class method for an interface operation with elipsis
+ *
+ * The arguments before the variadic argument are checked as for any other
+ *  operation. The variadic arguments are checked or coerced according to
+ *  their type and, for string, boolean and numeric types, collected into a
+ *  C array named after the argument with the binding prefix. The array is
+ *  held in a fixed buffer pushed above the arguments, so any number of
+ *  arguments may be collected and nothing leaks if an argument check
+ *  throws. The number of variadic arguments is available as the array
+ *  name with a _count suffix.
+ */
+static int
+output_interface_elipsis_operation(struct opctx *outc,
+                                   struct ir_entry *interfacee,
+                                   struct ir_operation_entry *operatione)
+{
+        int cdatac; /* cdata blocks output */
+        struct ir_operation_overload_entry *overloade;
+        struct ir_operation_argument_entry *variadice;
+        struct webidl_node *type_node;
+        enum webidl_type *variadic_type;
+        const struct sequence_marshal *marshal = NULL;
+        int typec;
+        int vidx; /* index of variadic argument */
+        int argidx; /* loop counter for arguments */
+        int res;
+
+        overloade = operatione->overloadv;
+
+        for (vidx = 0; vidx < overloade->argumentc; vidx++) {
+                if (overloade->argumentv[vidx].elipsisc != 0) {
+                        break;
+                }
+        }
+        variadice = overloade->argumentv + vidx;
+
+        /* element type of the variadic argument */
+        typec = webidl_node_enumerate_type(
+                webidl_node_getnode(variadice->node),
+                WEBIDL_NODE_TYPE_TYPE);
+        type_node = webidl_node_find_type(
+                webidl_node_getnode(variadice->node),
+                NULL,
+                WEBIDL_NODE_TYPE_TYPE);
+        variadic_type = (enum webidl_type *)webidl_node_getint(
+                webidl_node_find_type(
+                        webidl_node_getnode(type_node),
+                        NULL,
+                        WEBIDL_NODE_TYPE_TYPE_BASE));
+        if ((typec == 1) && (variadic_type != NULL)) {
+                /* unions, user and any types are not converted */
+                marshal = get_sequence_marshal(*variadic_type);
+        }
+
+        /* variadic method definition */
+        output_member_placement(outc, interfacee, "method", operatione->name,
+                                operatione->method != NULL);
+        outputf(outc,
+                "static duk_ret_t %s_%s_%s(duk_context *ctx)\n",
+                DLPFX, interfacee->class_name, operatione->name);
+        outputf(outc,
+                "{\n");
+
+        res = output_profile_entry(outc, interfacee, "method", operatione->name);
+        if (res != 0) {
+                return res;
+        }
+
+        output_operation_argument_count(outc, overloade, vidx, true);
+
+        /* generate argument type checks */
+
+        outputf(outc,
+                "\t/* check types of passed arguments are correct */\n");
+
+        for (argidx = 0; argidx < vidx; argidx++) {
+                output_operation_argument_type_check(outc,
+                                                     interfacee,
+                                                     operatione,
+                                                     overloade,
+                                                     argidx);
+        }
+
+        outputf(outc,
+                "\t/* variadic %s arguments */\n"
+                "\tduk_idx_t %s_%s_count = (%s_argc > %d) ? (%s_argc - %d) : 0;\n",
+                variadice->name,
+                DLPFX, variadice->name, DLPFX, vidx, DLPFX, vidx);
+
+        if (marshal == NULL) {
+                outputf(outc,
+                        "\t(void)%s_%s_count;\n",
+                        DLPFX, variadice->name);
+        } else {
+                outputf(outc,
+                        "\t%s*%s_%s = duk_push_fixed_buffer(ctx, %s_%s_count * sizeof(*%s_%s));\n"
+                        "\t{\n"
+                        "\t\tduk_idx_t %s_argi;\n"
+                        "\t\tfor (%s_argi = %d; %s_argi < %s_argc; %s_argi++) {\n",
+                        marshal->ctype, DLPFX, variadice->name,
+                        DLPFX, variadice->name, DLPFX, variadice->name,
+                        DLPFX,
+                        DLPFX, vidx, DLPFX, DLPFX, DLPFX);
+
+                switch (*variadic_type) {
+                case WEBIDL_TYPE_STRING:
+                        /* coerce values to string in place */
+                        outputf(outc,
+                                "\t\t\t%s_%s[%s_argi - %d] = duk_to_string(ctx, %s_argi);\n",
+                                DLPFX, variadice->name, DLPFX, vidx, DLPFX);
+                        break;
+
+                case WEBIDL_TYPE_BOOL:
+                        outputf(outc,
+                                "\t\t\tif (!duk_is_boolean(ctx, %s_argi)) {\n"
+                                "\t\t\t\treturn duk_error(ctx, DUK_ERR_ERROR, %s_error_fmt_bool_type, %s_argi, \"%s\");\n"
+                                "\t\t\t}\n"
+                                "\t\t\t%s_%s[%s_argi - %d] = duk_get_boolean(ctx, %s_argi);\n",
+                                DLPFX,
+                                DLPFX, DLPFX, variadice->name,
+                                DLPFX, variadice->name, DLPFX, vidx, DLPFX);
+                        break;
+
+                default:
+                        outputf(outc,
+                                "\t\t\tif (!duk_is_number(ctx, %s_argi)) {\n"
+                                "\t\t\t\treturn duk_error(ctx, DUK_ERR_ERROR, %s_error_fmt_number_type, %s_argi, \"%s\");\n"
+                                "\t\t\t}\n"
+                                "\t\t\t%s_%s[%s_argi - %d] = %s(ctx, %s_argi);\n",
+                                DLPFX,
+                                DLPFX, DLPFX, variadice->name,
+                                DLPFX, variadice->name, DLPFX, vidx,
+                                marshal->require, DLPFX);
+                        break;
+                }
+
+                outputf(outc,
+                        "\t\t}\n"
+                        "\t}\n");
+        }
+
+        output_get_method_private(outc, interfacee->class_name,
+                                  interfacee->u.interface.primary_global);
+
+        cdatac = output_ccode(outc, operatione->method);
+        if (cdatac == 0) {
+                /* no implementation so generate default */
+                WARN(WARNING_UNIMPLEMENTED,
+                     "Unimplemented: method %s::%s();",
+                     interfacee->name, operatione->name);
+                outputf(outc,
+                        "\treturn 0;\n");
+        }
+
+        outputf(outc,
+                "}\n\n");
+
+        return 0;
+}
+
+
 /**
  * generate a single class method for an interface operation
  */
@@ -1210,9 +1949,8 @@ output_interface_operation(struct opctx *outc,
 {
         int cdatac; /* cdata blocks output */
         struct ir_operation_overload_entry *overloade;
-        int fixedargc; /* number of non optional arguments */
         int argidx; /* loop counter for arguments */
-        int optargc; /* loop counter for optional arguments */
+        int res;
 
         if (operatione->name == NULL) {
                 return output_interface_special_operation(outc,
@@ -1220,6 +1958,14 @@ output_interface_operation(struct opctx *outc,
                                                           operatione);
         }
 
+        if (operation_stubbed(operatione)) {
+                /* the shared stub is used instead of a method */
+                WARN(WARNING_UNIMPLEMENTED,
+                     "Unimplemented: method %s::%s();",
+                     interfacee->name, operatione->name);
+                return 0;
+        }
+
         if (operatione->overloadc != 1) {
                 return output_interface_overloaded_operation(outc,
                                                              interfacee,
@@ -1235,61 +1981,24 @@ output_interface_operation(struct opctx *outc,
         /* normal method definition */
         overloade = operatione->overloadv;
 
+        output_member_placement(outc, interfacee, "method", operatione->name,
+                                operatione->method != NULL);
         outputf(outc,
                 "static duk_ret_t %s_%s_%s(duk_context *ctx)\n",
                 DLPFX, interfacee->class_name, operatione->name);
         outputf(outc,
                 "{\n");
 
-        /* check arguments */
-
-        /* generate check for minimum number of parameters */
-
-        fixedargc = overloade->argumentc - overloade->optionalc;
-
-        outputf(outc,
-                "\t/* ensure the parameters are present */\n"
-                "\tduk_idx_t %s_argc = duk_get_top(ctx);\n\t", DLPFX);
-
-        if (fixedargc > 0) {
-                outputf(outc,
-                        "if (%s_argc < %d) {\n",
-                        DLPFX, fixedargc);
-                outputf(outc,
-                        "\t\t/* not enough arguments */\n");
-                outputf(outc,
-                        "\t\treturn duk_error(ctx, DUK_RET_TYPE_ERROR, %s_error_fmt_argument, %d, %s_argc);\n",
-                        DLPFX, fixedargc, DLPFX);
-                outputf(outc,
-                        "\t} else ");
-        }
-
-        for (optargc = fixedargc;
-             optargc < overloade->argumentc;
-             optargc++) {
-                outputf(outc,
-                        "if (%s_argc == %d) {\n"
-                        "\t\t/* %d optional arguments need adding */\n",
-                        DLPFX,
-                        optargc,
-                        overloade->argumentc - optargc);
-                output_operation_optional_defaults(outc,
-                        overloade->argumentv + optargc,
-                        overloade->argumentc - optargc);
-                outputf(outc,
-                        "\t} else ");
+        res = output_profile_entry(outc, interfacee, "method", operatione->name);
+        if (res != 0) {
+                return res;
         }
 
-        outputf(outc,
-                "if (%s_argc > %d) {\n"
-                "\t\t/* remove extraneous parameters */\n"
-                "\t\tduk_set_top(ctx, %d);\n"
-                "\t}\n",
-                DLPFX,
-                overloade->argumentc,
-                overloade->argumentc);
-        outputf(outc,
-                "\n");
+        /* check arguments */
+        output_operation_argument_count(outc,
+                                        overloade,
+                                        overloade->argumentc,
+                                        false);
 
         /* generate argument type checks */
 
@@ -1329,22 +2038,60 @@ output_interface_operation(struct opctx *outc,
         return 0;
 }
 
+/**
+ * get the temperature of an interface operation
+ */
+static enum profile_temperature
+operation_temperature(struct opctx *outc,
+                      struct ir_entry *ife,
+                      struct ir_operation_entry *operatione)
+{
+        /* special operations generate no function */
+        if (operatione->name == NULL) {
+                return PROFILE_WARM;
+        }
+
+        return output_member_temperature(outc,
+                                         ife,
+                                         "method",
+                                         operatione->name,
+                                         operatione->method != NULL);
+}
+
 /**
  * generate class methods for each interface operation
+ *
+ * The methods are ordered hot, warm then cold so the most called are
+ *  placed together.
  */
 static int
 output_interface_operations(struct opctx *outc, struct ir_entry *ife)
 {
         int opc;
         int res = 0;
+        enum profile_temperature temperature;
 
-        for (opc = 0; opc < ife->u.interface.operationc; opc++) {
-                res = output_interface_operation(
-                        outc,
-                        ife,
-                        ife->u.interface.operationv + opc);
-                if (res != 0) {
-                        break;
+        for (temperature = PROFILE_HOT;
+             temperature <= PROFILE_COLD;
+             temperature++) {
+                for (opc = 0; opc < ife->u.interface.operationc; opc++) {
+                        struct ir_operation_entry *operatione;
+
+                        operatione = ife->u.interface.operationv + opc;
+
+                        if (operation_temperature(outc, ife, operatione) !=
+                            temperature) {
+                                continue;
+                        }
+
+                        output_member_cost_start(outc);
+                        res = output_interface_operation(outc, ife, operatione);
+                        output_member_cost_record(outc, ife, "method",
+                                                  (operatione->name != NULL) ?
+                                                  operatione->name : "(special)");
+                        if (res != 0) {
+                                return res;
+                        }
                 }
         }
 
@@ -1353,6 +2100,22 @@ output_interface_operations(struct opctx *outc, struct ir_entry *ife)
 
 
 
+/**
+ * get the type of an attribute as text for warnings
+ */
+static const char *attribute_type_str(struct ir_attribute_entry *atributee)
+{
+        if (atributee->typec == 0) {
+                return "";
+        }
+        if (atributee->typec == 1) {
+                return webidl_type_to_str(atributee->typev[0].modifier,
+                                          atributee->typev[0].base);
+        }
+        return "multiple";
+}
+
+
 /**
  * Output class property getter for a single attribute
  */
@@ -1361,20 +2124,46 @@ output_attribute_getter(struct opctx *outc,
                         struct ir_entry *interfacee,
                         struct ir_attribute_entry *atributee)
 {
+        int res;
+
+        if (atributee->reflect_magic != 0) {
+                /* the shared reflect accessor is used instead */
+                WARN(WARNING_GENERATED,
+                     "Reflected: getter %s::%s();",
+                     interfacee->name, atributee->name);
+                return 0;
+        }
+
+        if (getter_stubbed(atributee)) {
+                /* the shared stub is used instead of a getter */
+                WARN(WARNING_UNIMPLEMENTED,
+                     "Unimplemented: getter %s::%s(%s);",
+                     interfacee->name,
+                     atributee->name,
+                     attribute_type_str(atributee));
+                return 0;
+        }
+
         /* getter definition */
+        output_member_placement(outc, interfacee, "getter", atributee->name,
+                                atributee->getter != NULL);
         outputf(outc,
                 "static duk_ret_t %s_%s_%s_getter(duk_context *ctx)\n",
                 DLPFX, interfacee->class_name, atributee->name);
         outputf(outc,
                 "{\n");
 
+        res = output_profile_entry(outc, interfacee, "getter", atributee->name);
+        if (res != 0) {
+                return res;
+        }
+
         output_get_method_private(outc,
                                   interfacee->class_name,
                                   interfacee->u.interface.primary_global);
 
         /* if binding available for this attribute getter process it */
         if (atributee->getter != NULL) {
-                int res;
                 res = output_ccode(outc, atributee->getter);
                 if (res == 0) {
                         /* no code provided for this getter so generate */
@@ -1385,26 +2174,16 @@ output_attribute_getter(struct opctx *outc,
                 if (res >= 0) {
                         outputf(outc,
                                 "}\n\n");
-                        return res;
+                        return 0;
                 }
         }
 
         /* no implementation so generate default and warnings if required */
-        const char *type_str;
-        if (atributee->typec == 0) {
-                type_str = "";
-        } else if (atributee->typec == 1) {
-                type_str = webidl_type_to_str(atributee->typev[0].modifier,
-                                              atributee->typev[0].base);
-        } else {
-                type_str = "multiple";
-        }
-
         WARN(WARNING_UNIMPLEMENTED,
              "Unimplemented: getter %s::%s(%s);",
              interfacee->name,
              atributee->name,
-             type_str);
+             attribute_type_str(atributee));
 
         if (options->dbglog) {
                 outputf(outc,
@@ -1440,14 +2219,15 @@ output_putforwards_setter(struct opctx *outc,
                 "\tif (get_ret != 1) {\n"
                 "\t\treturn 0;\n"
                 "\t}\n\n"
-                "\t/* parameter ... attribute */\n\n"
-                "\tduk_dup(ctx, 0);\n"
-                "\t/* ... attribute parameter */\n\n"
-                "\t/* call the putforward */\n");
+                "\t/* parameter ... attribute */\n\n");
 
         outputf(outc,
-                "\tduk_put_prop_string(ctx, -2, \"%s\");\n\n",
-                atributee->putforwards);
+                "\t%s_push_key(ctx, %s%s);\n"
+                "\tduk_dup(ctx, 0);\n"
+                "\t/* ... attribute key parameter */\n\n"
+                "\t/* call the putforward */\n"
+                "\tduk_put_prop(ctx, -3);\n\n",
+                DLPFX, gen_key_prefix(), atributee->putforwards);
 
         outputf(outc,
                 "\treturn 0;\n");
@@ -1466,13 +2246,40 @@ output_attribute_setter(struct opctx *outc,
 {
         int res = -1;
 
+        if (atributee->reflect_magic != 0) {
+                /* the shared reflect accessor is used instead */
+                WARN(WARNING_GENERATED,
+                     "Reflected: setter %s::%s();",
+                     interfacee->name, atributee->name);
+                return 0;
+        }
+
+        if (setter_stubbed(atributee)) {
+                /* the shared stub is used instead of a setter */
+                WARN(WARNING_UNIMPLEMENTED,
+                     "Unimplemented: setter %s::%s(%s);",
+                     interfacee->name,
+                     atributee->name,
+                     attribute_type_str(atributee));
+                return 0;
+        }
+
        /* setter definition */
+        output_member_placement(outc, interfacee, "setter", atributee->name,
+                                (atributee->setter != NULL) ||
+                                (atributee->putforwards != NULL));
         outputf(outc,
                 "static duk_ret_t %s_%s_%s_setter(duk_context *ctx)\n",
                 DLPFX, interfacee->class_name, atributee->name);
         outputf(outc,
                 "{\n");
 
+        res = output_profile_entry(outc, interfacee, "setter", atributee->name);
+        if (res != 0) {
+                return res;
+        }
+
+        res = -1;
         output_get_method_private(outc,
                                   interfacee->class_name,
                                   interfacee->u.interface.primary_global);
@@ -1494,21 +2301,11 @@ output_attribute_setter(struct opctx *outc,
 
         /* implementation not generated from any other source */
         if (res < 0) {
-                const char *type_str;
-                if (atributee->typec == 0) {
-                        type_str = "";
-                } else if (atributee->typec == 1) {
-                        type_str = webidl_type_to_str(
-                                atributee->typev[0].modifier,
-                                atributee->typev[0].base);
-                } else {
-                        type_str = "multiple";
-                }
                 WARN(WARNING_UNIMPLEMENTED,
                      "Unimplemented: setter %s::%s(%s);",
                      interfacee->name,
                      atributee->name,
-                     type_str);
+                     attribute_type_str(atributee));
                 if (options->dbglog) {
                         outputf(outc,
                                "\tNSLOG(dukky, WARNING, \"Unimplemented\");\n");
@@ -1522,7 +2319,7 @@ output_attribute_setter(struct opctx *outc,
         outputf(outc,
                 "}\n\n");
 
-        return res;
+        return 0;
 }
 
 
@@ -1540,31 +2337,106 @@ output_interface_attribute(struct opctx *outc,
             atributee->property_name = gen_idl2c_name(atributee->name);
         }
 
+        if (atributee->reflect_magic != 0) {
+                /* the shared accessors are used so nothing is costed */
+                res = output_attribute_getter(outc, interfacee, atributee);
+                if ((res == 0) &&
+                    (atributee->modifier != WEBIDL_TYPE_MODIFIER_READONLY)) {
+                        res = output_attribute_setter(outc,
+                                                      interfacee,
+                                                      atributee);
+                }
+                return res;
+        }
+
+        output_member_cost_start(outc);
         res = output_attribute_getter(outc, interfacee, atributee);
+        output_member_cost_record(outc, interfacee, "getter", atributee->name);
+        if (res != 0) {
+                return res;
+        }
 
         /* only read/write and putforward attributes have a setter */
         if ((atributee->modifier != WEBIDL_TYPE_MODIFIER_READONLY) ||
             (atributee->putforwards != NULL)) {
+                output_member_cost_start(outc);
                 res = output_attribute_setter(outc, interfacee, atributee);
+                output_member_cost_record(outc, interfacee, "setter",
+                                          atributee->name);
         }
 
         return res;
 }
 
 
+/**
+ * get the temperature of an interface attribute
+ *
+ * The getter and setter are kept together so the attribute is as hot
+ *  as the hotter of the two.
+ */
+static enum profile_temperature
+attribute_temperature(struct opctx *outc,
+                      struct ir_entry *ife,
+                      struct ir_attribute_entry *atributee)
+{
+        enum profile_temperature temperature;
+        enum profile_temperature setter_temperature;
+
+        temperature = output_member_temperature(outc,
+                                                ife,
+                                                "getter",
+                                                atributee->name,
+                                                atributee->getter != NULL);
+
+        if ((atributee->modifier != WEBIDL_TYPE_MODIFIER_READONLY) ||
+            (atributee->putforwards != NULL)) {
+                setter_temperature = output_member_temperature(
+                        outc,
+                        ife,
+                        "setter",
+                        atributee->name,
+                        (atributee->setter != NULL) ||
+                        (atributee->putforwards != NULL));
+                if (setter_temperature < temperature) {
+                        temperature = setter_temperature;
+                }
+        }
+
+        return temperature;
+}
+
 /**
  * generate class property getters and setters for each interface attribute
+ *
+ * The attributes are ordered hot, warm then cold so the most called are
+ *  placed together.
  */
 static int
 output_interface_attributes(struct opctx *outc, struct ir_entry *ife)
 {
         int attrc;
+        int res;
+        enum profile_temperature temperature;
 
-        for (attrc = 0; attrc < ife->u.interface.attributec; attrc++) {
-                output_interface_attribute(
-                        outc,
-                        ife,
-                        ife->u.interface.attributev + attrc);
+        for (temperature = PROFILE_HOT;
+             temperature <= PROFILE_COLD;
+             temperature++) {
+                for (attrc = 0; attrc < ife->u.interface.attributec; attrc++) {
+                        struct ir_attribute_entry *atributee;
+
+                        atributee = ife->u.interface.attributev + attrc;
+
+                        if (attribute_temperature(outc, ife, atributee) !=
+                            temperature) {
+                                continue;
+                        }
+
+                        res = output_interface_attribute(outc, ife, atributee);
+                        if (res != 0) {
+                                return res;
+                        }
+                }
         }
 
         return 0;
@@ -1576,14 +2448,19 @@ output_interface_attributes(struct opctx *outc, struct ir_entry *ife)
  *
  * exported interface documented in duk-libdom.h
  */
-int output_interface(struct ir *ir, struct ir_entry *interfacee)
+int output_interface(struct duk_libdom_ctx *dlctx,
+                     struct ir *ir,
+                     struct ir_entry *interfacee)
 {
         struct opctx *ifop;
         struct ir_entry *inherite;
         int res = 0;
 
         /* open the output */
-        res = output_open(interfacee->filename, &ifop);
+        res = output_open(dlctx->outdirname,
+                          interfacee->filename,
+                          dlctx,
+                          &ifop);
         if (res !=0 ) {
                 return res;
         }
@@ -1591,55 +2468,44 @@ int output_interface(struct ir *ir, struct ir_entry *interfacee)
         /* find parent interface entry */
         inherite = ir_inherit_entry(ir, interfacee);
 
-        /* tool preface */
-        output_tool_preface(ifop);
-
-        /* binding preface */
-        output_method_cdata(ifop,
-                            ir->binding_node,
-                            GENBIND_METHOD_TYPE_PREFACE);
-
-        /* class preface */
-        output_method_cdata(ifop,
-                            interfacee->class,
-                            GENBIND_METHOD_TYPE_PREFACE);
-
-        /* tool prologue */
-        output_tool_prologue(ifop);
-
-        /* binding prologue */
-        output_method_cdata(ifop,
-                            ir->binding_node,
-                            GENBIND_METHOD_TYPE_PROLOGUE);
-
-        /* class prologue */
-        output_method_cdata(ifop,
-                            interfacee->class,
-                            GENBIND_METHOD_TYPE_PROLOGUE);
+        /* prefaces and prologues */
+        output_source_preamble(ifop, ir, interfacee);
 
         outputf(ifop,
                 "\n");
 
         /* initialisor */
-        res = output_interface_init(ifop, interfacee, inherite);
+        res = output_interface_init(ifop, ir, interfacee, inherite);
         if (res != 0) {
                 goto op_error;
         }
 
         /* finaliser */
-        output_interface_fini(ifop, interfacee, inherite);
+        output_interface_fini(ifop, ir, interfacee, inherite);
 
         /* constructor */
-        output_interface_constructor(ifop, interfacee);
+        res = output_interface_constructor(ifop, interfacee);
+        if (res != 0) {
+                goto op_error;
+        }
 
         /* destructor */
-        output_interface_destructor(ifop, interfacee);
+        res = output_interface_destructor(ifop, interfacee);
+        if (res != 0) {
+                goto op_error;
+        }
 
         /* operations */
-        output_interface_operations(ifop, interfacee);
+        res = output_interface_operations(ifop, interfacee);
+        if (res != 0) {
+                goto op_error;
+        }
 
         /* attributes */
-        output_interface_attributes(ifop, interfacee);
+        res = output_interface_attributes(ifop, interfacee);
+        if (res != 0) {
+                goto op_error;
+        }
 
         /* prototype */
         output_interface_prototype(ifop, ir, interfacee, inherite);
@@ -0,0 +1,251 @@
+/* duktape binding unity build shard generation
+ *
+ * This file is part of nsgenbind.
+ * Licensed under the MIT License,
+ *                http://www.opensource.org/licenses/mit-license.php
+ * Copyright 2012 Vincent Sanders <vince@netsurf-browser.org>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "options.h"
+#include "utils.h"
+#include "nsgenbind-ast.h"
+#include "webidl-ast.h"
+#include "ir.h"
+#include "output.h"
+#include "profile.h"
+#include "duk-libdom.h"
+
+/** a group of entries kept in the same shard */
+struct shard_group {
+        int id; /**< group identifier */
+        unsigned long weight; /**< estimated size of group */
+};
+
+/**
+ * test if an ir entry has a generated source
+ */
+static bool entry_has_source(struct ir_entry *entry)
+{
+        if (entry->filename == NULL) {
+                return false;
+        }
+        if ((entry->type == IR_ENTRY_TYPE_INTERFACE) &&
+            (entry->u.interface.noobject)) {
+                return false;
+        }
+        return true;
+}
+
+/**
+ * estimate the size of the generated source of an ir entry
+ */
+static unsigned long entry_weight(struct ir_entry *entry)
+{
+        if (!entry_has_source(entry)) {
+                return 0;
+        }
+
+        if (entry->type == IR_ENTRY_TYPE_DICTIONARY) {
+                return 4 + entry->u.dictionary.memberc;
+        }
+
+        return 4 +
+                (3 * entry->u.interface.operationc) +
+                (2 * entry->u.interface.attributec) +
+                entry->u.interface.constantc;
+}
+
+static int group_weight_cmp(const void *a, const void *b)
+{
+        const struct shard_group *ga = a;
+        const struct shard_group *gb = b;
+
+        if (ga->weight == gb->weight) {
+                return ga->id - gb->id;
+        }
+        return (ga->weight < gb->weight) ? 1 : -1;
+}
+
+/**
+ * assign each ir entry to a shard
+ *
+ * Entries are grouped by inheritance subtree so an interface is built
+ *  with its ancestors where possible. Subtrees larger than an even
+ *  share of the binding are split into their root and the subtrees of
+ *  its children. The groups are then placed, largest first, in the
+ *  least loaded shard.
+ *
+ * \param ir The intermediate representation.
+ * \param shardc The number of shards.
+ * \param shardv Updated with the shard of each entry.
+ * \return 0 on success or -1 on allocation error.
+ */
+static int
+assign_shards(struct ir *ir, int shardc, int *shardv)
+{
+        unsigned long *subtreev;
+        unsigned long *loadv;
+        int *groupv;
+        int *groupshardv;
+        struct shard_group *groups;
+        int groupc = 0;
+        unsigned long target;
+        int idx;
+        int gidx;
+        int sidx;
+        int best;
+
+        subtreev = calloc(ir->entryc, sizeof(unsigned long));
+        groupv = calloc(ir->entryc, sizeof(int));
+        groupshardv = calloc(ir->entryc, sizeof(int));
+        groups = calloc(ir->entryc, sizeof(struct shard_group));
+        loadv = calloc(shardc, sizeof(unsigned long));
+        if ((subtreev == NULL) ||
+            (groupv == NULL) ||
+            (groupshardv == NULL) ||
+            (groups == NULL) ||
+            (loadv == NULL)) {
+                free(subtreev);
+                free(groupv);
+                free(groupshardv);
+                free(groups);
+                free(loadv);
+                return -1;
+        }
+
+        /* entries are sorted with parents before their children */
+        for (idx = ir->entryc - 1; idx >= 0; idx--) {
+                subtreev[idx] += entry_weight(ir->entries + idx);
+                if (ir->entries[idx].inherit_idx != -1) {
+                        subtreev[ir->entries[idx].inherit_idx] += subtreev[idx];
+                }
+        }
+
+        target = 0;
+        for (idx = 0; idx < ir->entryc; idx++) {
+                if (ir->entries[idx].inherit_idx == -1) {
+                        target += subtreev[idx];
+                }
+        }
+        target = (target + shardc - 1) / shardc;
+
+        /* form groups from subtrees no larger than the target */
+        for (idx = 0; idx < ir->entryc; idx++) {
+                int parent = ir->entries[idx].inherit_idx;
+
+                if ((parent != -1) && (subtreev[parent] <= target)) {
+                        /* whole subtree of parent is one group */
+                        groupv[idx] = groupv[parent];
+                } else {
+                        groups[groupc].id = groupc;
+                        groupv[idx] = groupc++;
+                }
+                groups[groupv[idx]].weight += entry_weight(ir->entries + idx);
+        }
+
+        /* place groups largest first in least loaded shard */
+        qsort(groups, groupc, sizeof(struct shard_group), group_weight_cmp);
+
+        for (gidx = 0; gidx < groupc; gidx++) {
+                best = 0;
+                for (sidx = 1; sidx < shardc; sidx++) {
+                        if (loadv[sidx] < loadv[best]) {
+                                best = sidx;
+                        }
+                }
+                loadv[best] += groups[gidx].weight;
+                groupshardv[groups[gidx].id] = best;
+        }
+
+        for (idx = 0; idx < ir->entryc; idx++) {
+                shardv[idx] = groupshardv[groupv[idx]];
+        }
+
+        free(subtreev);
+        free(groupv);
+        free(groupshardv);
+        free(groups);
+        free(loadv);
+
+        return 0;
+}
+
+/* exported interface documented in duk-libdom.h */
+int output_shards(struct duk_libdom_ctx *dlctx, struct ir *ir, int shardc)
+{
+        int *shardv;
+        int idx;
+        int sidx;
+        int res = 0;
+        char *fpath;
+        char shardname[32];
+        struct opctx *shardop;
+
+        shardv = calloc(ir->entryc + 1, sizeof(int));
+        if (shardv == NULL) {
+                return -1;
+        }
+
+        res = assign_shards(ir, shardc, shardv);
+        if (res != 0) {
+                free(shardv);
+                return res;
+        }
+
+        for (sidx = 0; sidx < shardc; sidx++) {
+                snprintf(shardname, sizeof(shardname), "shard-%d.c", sidx);
+
+                res = output_open(dlctx->outdirname,
+                                  shardname,
+                                  dlctx,
+                                  &shardop);
+                if (res != 0) {
+                        break;
+                }
+
+                output_tool_preface(shardop);
+
+                /* the precompiled common header must come first */
+                if (options->commonheader) {
+                        fpath = genb_fpath(dlctx->outdirname, "common.h");
+                        outputf(shardop, "\n#include \"%s\"\n", fpath);
+                        free(fpath);
+                }
+
+                outputf(shardop, "\n/* Unity build shard %d of %d */\n",
+                        sidx + 1, shardc);
+
+                /* a single shard is the whole binding */
+                if (shardc == 1) {
+                        fpath = genb_fpath(dlctx->outdirname, "binding.c");
+                        outputf(shardop, "#include \"%s\"\n", fpath);
+                        free(fpath);
+                }
+
+                /* the sources share a translation unit so the helpers
+                 * and macros of their class prefaces and prologues
+                 * must not collide, generated names are per class
+                 */
+                for (idx = 0; idx < ir->entryc; idx++) {
+                        if ((shardv[idx] != sidx) ||
+                            (!entry_has_source(ir->entries + idx))) {
+                                continue;
+                        }
+                        fpath = genb_fpath(dlctx->outdirname,
+                                           ir->entries[idx].filename);
+                        outputf(shardop, "#include \"%s\"\n", fpath);
+                        free(fpath);
+                }
+
+                output_close(shardop);
+        }
+
+        free(shardv);
+
+        return res;
+}
@@ -21,19 +21,26 @@
 #include "webidl-ast.h"
 #include "ir.h"
 #include "output.h"
+#include "profile.h"
 #include "duk-libdom.h"
+#include "stats.h"
 
 /** prefix for all generated functions */
 #define DLPFX "dukky"
 
 #define MAGICPFX "\\xFF\\xFFNETSURF_DUKTAPE_"
 
+/** largest duktape function magic value */
+#define MAGIC_MAX 32767
+
+/** interface name profiled functions of the shared reflect accessors use */
+#define REFLECT_PROFILE_NAME "reflect"
+
 /**
  * \todo Constructors
  * \todo dukky_inject_not_ctr as binding.c function
  * \todo instanceof needs cleaning/generalising
  * \todo large text sections
- * \todo operations with elipsis need parameter checking love
  * \todo parameter type checking probably should do instanceof on user objects
  * \todo tool should generate warning for interfaces with empty private structs for the entire inheritance chain
  */
@@ -63,7 +70,8 @@ static char *get_prototype_name(const char *interface_name)
 
 
 
-static struct opctx *open_header(struct ir *ir, const char *name)
+static struct opctx *
+open_header(struct duk_libdom_ctx *dlctx, struct ir *ir, const char *name)
 {
         char *fname;
         int fnamel;
@@ -75,7 +83,7 @@ static struct opctx *open_header(struct ir *ir, const char *name)
         snprintf(fname, fnamel, "%s.h", name);
 
         /* open the output header file */
-        res = output_open(fname, &hdrc);
+        res = output_open(dlctx->outdirname, fname, dlctx, &hdrc);
         free(fname);
         if (res != 0 ) {
                 return NULL;
@@ -115,158 +123,1301 @@ static int close_header(struct ir *ir, struct opctx *hdrc)
 }
 
 
+/**
+ * generate the private struct of an ir entry
+ */
+static int
+output_private_struct(struct opctx *privc,
+                      struct ir *ir,
+                      struct ir_entry *interfacee)
+{
+        struct ir_entry *inherite;
+        struct genbind_node *priv_node;
+
+        /* do not generate private structs for interfaces marked no
+         * output
+         */
+        if ((interfacee->type == IR_ENTRY_TYPE_INTERFACE) &&
+            (interfacee->u.interface.noobject)) {
+                return 0;
+        }
+
+        switch (interfacee->type) {
+        case IR_ENTRY_TYPE_INTERFACE:
+                outputf(privc,
+                        "/* Private data for %s interface */\n",
+                        interfacee->name);
+                break;
+
+        case IR_ENTRY_TYPE_DICTIONARY:
+                outputf(privc,
+                        "/* Private data for %s dictionary */\n",
+                        interfacee->name);
+                break;
+        }
+
+        outputf(privc,
+                "typedef struct {\n");
+
+        /* find parent entry and include in private */
+        inherite = ir_inherit_entry(ir, interfacee);
+        if (inherite != NULL) {
+                outputf(privc,
+                        "\t%s_private_t parent;\n",
+                        inherite->class_name);
+        }
+
+        /* for each private variable on the class output it here. */
+        priv_node = genbind_node_find_type(
+                genbind_node_getnode(interfacee->class),
+                NULL,
+                GENBIND_NODE_TYPE_PRIVATE);
+        while (priv_node != NULL) {
+                outputc(privc, '\t');
+
+                output_ctype(privc, priv_node, true);
+
+                outputf(privc, ";\n");
+
+                priv_node = genbind_node_find_type(
+                        genbind_node_getnode(interfacee->class),
+                        priv_node,
+                        GENBIND_NODE_TYPE_PRIVATE);
+        }
+
+        outputf(privc,
+                "} __attribute__((aligned)) %s_private_t;\n\n",
+                interfacee->class_name);
+
+        return 0;
+}
+
+/**
+ * generate the prototype declarations of an ir entry
+ */
+static int
+output_entry_declaration(struct opctx *protoc,
+                         struct ir *ir,
+                         struct ir_entry *entry)
+{
+        switch (entry->type) {
+        case IR_ENTRY_TYPE_INTERFACE:
+                output_interface_declaration(protoc, entry);
+                break;
+
+        case IR_ENTRY_TYPE_DICTIONARY:
+                output_dictionary_declaration(protoc, ir, entry);
+                break;
+        }
+
+        return 0;
+}
+
+/**
+ * include every class header in an aggregate header
+ */
+static int output_class_includes(struct opctx *outc, struct ir *ir)
+{
+        int idx;
+
+        for (idx = 0; idx < ir->entryc; idx++) {
+                if (ir->entries[idx].class_name != NULL) {
+                        output_class_include(outc, ir->entries + idx);
+                }
+        }
+
+        return 0;
+}
+
 /**
  * generate private header
  */
 static int
-output_private_header(struct ir *ir)
+output_private_header(struct duk_libdom_ctx *dlctx, struct ir *ir)
+{
+        int idx;
+        struct opctx *privc;
+
+        /* open header */
+        privc = open_header(dlctx, ir, "private");
+
+        if (options->splitheaders) {
+                output_class_includes(privc, ir);
+        } else {
+                for (idx = 0; idx < ir->entryc; idx++) {
+                        output_private_struct(privc, ir, ir->entries + idx);
+                }
+        }
+
+        close_header(ir, privc);
+
+        return 0;
+}
+
+/**
+ * generate prototype header
+ */
+static int
+output_prototype_header(struct duk_libdom_ctx *dlctx, struct ir *ir)
+{
+        int idx;
+        struct opctx *protoc;
+
+        /* open header */
+        protoc = open_header(dlctx, ir, "prototype");
+
+        if (options->splitheaders) {
+                output_class_includes(protoc, ir);
+        } else {
+                for (idx = 0; idx < ir->entryc; idx++) {
+                        output_entry_declaration(protoc, ir, ir->entries + idx);
+                }
+        }
+
+        close_header(ir, protoc);
+
+        return 0;
+}
+
+/**
+ * generate a header for each class
+ *
+ * A class header holds the private struct and prototype declarations of
+ *  one ir entry and includes only the header of its parent so a change
+ *  to one class recompiles just that class and its descendants.
+ */
+static int
+output_class_headers(struct duk_libdom_ctx *dlctx, struct ir *ir)
+{
+        int idx;
+        struct opctx *hdrc;
+        struct ir_entry *entry;
+        struct ir_entry *inherite;
+
+        for (idx = 0; idx < ir->entryc; idx++) {
+                entry = ir->entries + idx;
+
+                if (entry->class_name == NULL) {
+                        continue;
+                }
+
+                hdrc = open_header(dlctx, ir, entry->class_name);
+                if (hdrc == NULL) {
+                        return -1;
+                }
+
+                inherite = ir_inherit_entry(ir, entry);
+                if ((inherite != NULL) && (inherite->class_name != NULL)) {
+                        output_class_include(hdrc, inherite);
+                        outputc(hdrc, '\n');
+                }
+
+                output_private_struct(hdrc, ir, entry);
+
+                output_entry_declaration(hdrc, ir, entry);
+
+                close_header(ir, hdrc);
+        }
+
+        return 0;
+}
+
+/**
+ * generate common header
+ *
+ * The binding preface, support and aggregate headers and binding
+ *  prologue shared by every generated source are placed in one header
+ *  each source includes first so it may be precompiled. With split
+ *  headers the binding prologue is left to each source so it follows
+ *  the class header as it would without the common header.
+ */
+static int
+output_common_header(struct duk_libdom_ctx *dlctx, struct ir *ir)
+{
+        char *fpath;
+        struct opctx *commonc;
+
+        /* open header */
+        commonc = open_header(dlctx, ir, "common");
+        if (commonc == NULL) {
+                return -1;
+        }
+
+        if (options->splitheaders) {
+                /* class headers are included by each source */
+                fpath = genb_fpath(dlctx->outdirname, "binding.h");
+                outputf(commonc, "#include \"%s\"\n", fpath);
+                free(fpath);
+        } else {
+                output_tool_prologue(commonc, NULL);
+
+                /* binding prologue */
+                output_method_cdata(commonc,
+                                    ir->binding_node,
+                                    GENBIND_METHOD_TYPE_PROLOGUE);
+        }
+
+        close_header(ir, commonc);
+
+        return 0;
+}
+
+/**
+ * generate makefile fragment
+ */
+static int
+output_makefile(struct duk_libdom_ctx *dlctx, struct ir *ir)
+{
+        int idx;
+        FILE *makef;
+
+        /* open output file */
+        makef = genb_fopen_tmp(dlctx->outdirname, "Makefile");
+        if (makef == NULL) {
+                return -1;
+        }
+
+        fprintf(makef, "# duk libdom makefile fragment\n\n");
+
+        fprintf(makef, "NSGENBIND_SOURCES:=");
+        if (options->shards > 0) {
+                /* the shards include the interface sources */
+                if (options->shards > 1) {
+                        fprintf(makef, "binding.c ");
+                }
+                for (idx = 0; idx < options->shards; idx++) {
+                        fprintf(makef, "shard-%d.c ", idx);
+                }
+        } else {
+                fprintf(makef, "binding.c ");
+                for (idx = 0; idx < ir->entryc; idx++) {
+                        struct ir_entry *interfacee;
+
+                        interfacee = ir->entries + idx;
+
+                        /* no source for interfaces marked no output */
+                        if ((interfacee->type == IR_ENTRY_TYPE_INTERFACE) &&
+                            (interfacee->u.interface.noobject)) {
+                                continue;
+                        }
+
+                        fprintf(makef, "%s ", interfacee->filename);
+                }
+        }
+        fprintf(makef, "\nNSGENBIND_PREFIX:=%s\n", dlctx->outdirname);
+
+        if (options->commonheader) {
+                /* precompile the common header the sources include */
+                fprintf(makef, "NSGENBIND_PCH:=$(NSGENBIND_PREFIX)/common.h.gch\n\n");
+                fprintf(makef, "$(NSGENBIND_PCH): $(NSGENBIND_PREFIX)/common.h $(NSGENBIND_PREFIX)/binding.h");
+                if (!options->splitheaders) {
+                        fprintf(makef, " $(NSGENBIND_PREFIX)/private.h $(NSGENBIND_PREFIX)/prototype.h");
+                }
+                fprintf(makef, "\n\t$(CC) $(CFLAGS) -x c-header -o $@ $<\n");
+
+                /* the sources are rebuilt with the header they include */
+                fprintf(makef, "\n$(addprefix $(NSGENBIND_PREFIX)/,$(NSGENBIND_SOURCES)): $(NSGENBIND_PCH)\n");
+        }
+
+        genb_fclose_tmp(makef, dlctx->outdirname, "Makefile");
+
+        return 0;
+}
+
+
+/**
+ * get the property keys interned by the binding
+ *
+ * The keys are the dictionary member and putforwards names each listed
+ *  once.
+ *
+ * \param ir The intermediate representation of the binding tree.
+ * \param keyc_out Updated with the number of keys.
+ * \return The array of key names which the caller must free.
+ */
+static const char **get_binding_keys(struct ir *ir, int *keyc_out)
+{
+        const char **keyv;
+        int keyc = 0;
+        int keyalloc = 0;
+        int idx;
+
+        for (idx = 0; idx < ir->entryc; idx++) {
+                struct ir_entry *entry;
+
+                entry = ir->entries + idx;
+                if (entry->type == IR_ENTRY_TYPE_DICTIONARY) {
+                        keyalloc += entry->u.dictionary.memberc;
+                } else {
+                        keyalloc += entry->u.interface.attributec;
+                }
+        }
+
+        keyv = calloc(keyalloc + 1, sizeof(const char *));
+
+        for (idx = 0; idx < ir->entryc; idx++) {
+                struct ir_entry *entry;
+                const char *name;
+                int namec;
+                int nameidx;
+                int keyidx;
+
+                entry = ir->entries + idx;
+                if (entry->type == IR_ENTRY_TYPE_DICTIONARY) {
+                        namec = entry->u.dictionary.memberc;
+                } else {
+                        namec = entry->u.interface.attributec;
+                }
+
+                for (nameidx = 0; nameidx < namec; nameidx++) {
+                        if (entry->type == IR_ENTRY_TYPE_DICTIONARY) {
+                                name = entry->u.dictionary.memberv[nameidx].name;
+                        } else {
+                                name = entry->u.interface.attributev[nameidx].putforwards;
+                        }
+                        if (name == NULL) {
+                                continue;
+                        }
+
+                        for (keyidx = 0; keyidx < keyc; keyidx++) {
+                                if (strcmp(keyv[keyidx], name) == 0) {
+                                        break;
+                                }
+                        }
+                        if (keyidx == keyc) {
+                                keyv[keyc++] = name;
+                        }
+                }
+        }
+
+        *keyc_out = keyc;
+        return keyv;
+}
+
+
+/**
+ * generate interned key declarations
+ */
+static int output_key_declarations(struct opctx *outc, struct ir *ir)
+{
+        const char **keyv;
+        int keyc;
+        int keyidx;
+
+        keyv = get_binding_keys(ir, &keyc);
+        if (keyc > 0) {
+                outputf(outc, "/* Interned property keys */\nenum %s_key {\n", DLPFX);
+                for (keyidx = 0; keyidx < keyc; keyidx++) {
+                        outputf(outc, "\t%s%s,\n",
+                                gen_key_prefix(), keyv[keyidx]);
+                }
+                outputf(outc, "\t%s_COUNT\n};\n\n", gen_key_prefix());
+
+                outputf(outc,
+                        "void %s_push_key(duk_context *ctx, enum %s_key key);\n\n",
+                        DLPFX, DLPFX);
+        }
+        free(keyv);
+
+        return 0;
+}
+
+
+/**
+ * generate interned key implementation
+ *
+ * The key strings are interned once when the prototypes are created and
+ *  kept reachable from an array in the global stash of each heap. Their
+ *  heap pointers are cached per heap, identified by its global stash, so
+ *  pushing a key is an indexed read of the cache of the heap in use. The
+ *  cache of a heap is filled when its keys are interned, replacing that
+ *  of any destroyed heap whose stash had the same address, and reloaded
+ *  from the stash if it was replaced by that of another heap.
+ *
+ * \return The number of keys output.
+ */
+static int output_keys(struct opctx *outc, struct ir *ir)
+{
+        const char **keyv;
+        int keyc;
+        int keyidx;
+
+        keyv = get_binding_keys(ir, &keyc);
+        if (keyc == 0) {
+                free(keyv);
+                return 0;
+        }
+
+        outputf(outc,
+                "/* Interned property keys */\n"
+                "static const char *%s_key_names[%s_COUNT] = {\n",
+                DLPFX, gen_key_prefix());
+        for (keyidx = 0; keyidx < keyc; keyidx++) {
+                outputf(outc, "\t\"%s\",\n", keyv[keyidx]);
+        }
+        outputf(outc, "};\n\n");
+        free(keyv);
+
+        outputf(outc,
+                "#define %s_HEAPS 4\n"
+                "\n"
+                "struct %s_key_cache {\n"
+                "\tvoid *stash;\n"
+                "\tvoid *keys[%s_COUNT];\n"
+                "};\n"
+                "\n"
+                "static struct %s_key_cache %s_key_cachev[%s_HEAPS];\n"
+                "static struct %s_key_cache *%s_key_cache = &%s_key_cachev[0];\n"
+                "static unsigned int %s_key_cachei;\n"
+                "\n",
+                gen_key_prefix(), DLPFX, gen_key_prefix(),
+                DLPFX, DLPFX, gen_key_prefix(),
+                DLPFX, DLPFX, DLPFX,
+                DLPFX);
+
+        outputf(outc,
+                "static void %s_load_keys(duk_context *ctx, void *stash, duk_bool_t reload)\n"
+                "{\n"
+                "\tstruct %s_key_cache *cache = NULL;\n"
+                "\tduk_uarridx_t keyi;\n"
+                "\tfor (keyi = 0; keyi < %s_HEAPS; keyi++) {\n"
+                "\t\tif (%s_key_cachev[keyi].stash == stash) {\n"
+                "\t\t\tcache = &%s_key_cachev[keyi];\n"
+                "\t\t\tbreak;\n"
+                "\t\t}\n"
+                "\t}\n"
+                "\tif ((cache != NULL) && !reload) {\n"
+                "\t\t%s_key_cache = cache;\n"
+                "\t\treturn;\n"
+                "\t}\n"
+                "\tif (cache == NULL) {\n"
+                "\t\tcache = &%s_key_cachev[%s_key_cachei];\n"
+                "\t\t%s_key_cachei = (%s_key_cachei + 1) %% %s_HEAPS;\n"
+                "\t}\n"
+                "\t/* ... stash */\n"
+                "\tduk_get_prop_string(ctx, -1, %s_magic_string_keys);\n"
+                "\t/* ... stash keys */\n"
+                "\tfor (keyi = 0; keyi < %s_COUNT; keyi++) {\n"
+                "\t\tduk_get_prop_index(ctx, -1, keyi);\n"
+                "\t\tcache->keys[keyi] = duk_get_heapptr(ctx, -1);\n"
+                "\t\tduk_pop(ctx);\n"
+                "\t}\n"
+                "\tduk_pop(ctx);\n"
+                "\t/* ... stash */\n"
+                "\tcache->stash = stash;\n"
+                "\t%s_key_cache = cache;\n"
+                "}\n"
+                "\n",
+                DLPFX, DLPFX, gen_key_prefix(), DLPFX, DLPFX,
+                DLPFX, DLPFX, DLPFX, DLPFX, DLPFX, gen_key_prefix(),
+                DLPFX, gen_key_prefix(), DLPFX);
+
+        outputf(outc,
+                "static void %s_intern_keys(duk_context *ctx)\n"
+                "{\n"
+                "\tduk_uarridx_t keyi;\n"
+                "\tduk_push_global_stash(ctx);\n"
+                "\tduk_push_array(ctx);\n"
+                "\t/* stash keys */\n"
+                "\tfor (keyi = 0; keyi < %s_COUNT; keyi++) {\n"
+                "\t\tduk_push_string(ctx, %s_key_names[keyi]);\n"
+                "\t\tduk_put_prop_index(ctx, -2, keyi);\n"
+                "\t}\n"
+                "\tduk_put_prop_string(ctx, -2, %s_magic_string_keys);\n"
+                "\t/* stash */\n"
+                "\t%s_load_keys(ctx, duk_get_heapptr(ctx, -1), 1);\n"
+                "\tduk_pop(ctx);\n"
+                "}\n"
+                "\n",
+                DLPFX, gen_key_prefix(), DLPFX, DLPFX, DLPFX);
+
+        outputf(outc,
+                "void %s_push_key(duk_context *ctx, enum %s_key key)\n"
+                "{\n"
+                "\tvoid *stash;\n"
+                "\tduk_push_global_stash(ctx);\n"
+                "\tstash = duk_get_heapptr(ctx, -1);\n"
+                "\t/* ... stash */\n"
+                "\tif (%s_key_cache->stash != stash) {\n"
+                "\t\t/* cached keys belong to another heap */\n"
+                "\t\t%s_load_keys(ctx, stash, 0);\n"
+                "\t}\n"
+                "\tduk_pop(ctx);\n"
+                "\tduk_push_heapptr(ctx, %s_key_cache->keys[key]);\n"
+                "\t/* ... key */\n"
+                "}\n"
+                "\n",
+                DLPFX, DLPFX, DLPFX, DLPFX, DLPFX);
+
+        return keyc;
+}
+
+
+/**
+ * generate sequence marshalling helper declarations
+ */
+static int output_sequence_helper_declarations(struct opctx *outc)
+{
+        const struct sequence_marshal *marshal;
+
+        outputf(outc, "/* Sequence marshalling */\n");
+
+        for (marshal = sequence_marshalv; marshal->name != NULL; marshal++) {
+                outputf(outc,
+                        "duk_idx_t %s_push_%s_sequence(duk_context *ctx, %sconst *seq, duk_size_t seqc);\n",
+                        DLPFX, marshal->name, marshal->ctype);
+                outputf(outc,
+                        "duk_size_t %s_get_%s_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, %s**seq_out);\n",
+                        DLPFX, marshal->name, marshal->ctype);
+        }
+        outputf(outc, "\n");
+
+        return 0;
+}
+
+
+/**
+ * generate sequence marshalling helpers
+ *
+ * The push helpers fill a new array in index order so it stays dense.
+ *
+ * The get helpers query the array length once and read each element into a
+ *  C array held in a fixed buffer pushed on top of the stack. The buffer
+ *  is owned by the duktape heap so nothing leaks if an element is the
+ *  wrong type and an error is thrown. The caller pops the buffer when it
+ *  has finished with the elements. Errors report the argument index and
+ *  name given by the caller as the argument checks do.
+ */
+static int output_sequence_helpers(struct opctx *outc)
+{
+        const struct sequence_marshal *marshal;
+
+        for (marshal = sequence_marshalv; marshal->name != NULL; marshal++) {
+                outputf(outc,
+                        "duk_idx_t\n"
+                        "%s_push_%s_sequence(duk_context *ctx, %sconst *seq, duk_size_t seqc)\n"
+                        "{\n"
+                        "\tduk_idx_t arr_idx;\n"
+                        "\tduk_uarridx_t seqi;\n"
+                        "\tarr_idx = duk_push_array(ctx);\n"
+                        "\t/* ... arr */\n"
+                        "\tfor (seqi = 0; seqi < seqc; seqi++) {\n"
+                        "\t\t%s(ctx, seq[seqi]);\n"
+                        "\t\tduk_put_prop_index(ctx, arr_idx, seqi);\n"
+                        "\t}\n"
+                        "\treturn arr_idx;\n"
+                        "}\n"
+                        "\n",
+                        DLPFX, marshal->name, marshal->ctype,
+                        marshal->push);
+
+                outputf(outc,
+                        "duk_size_t\n"
+                        "%s_get_%s_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, %s**seq_out)\n"
+                        "{\n"
+                        "\tduk_size_t seqc;\n"
+                        "\tduk_uarridx_t seqi;\n"
+                        "\t%s*seq;\n"
+                        "\tidx = duk_normalize_index(ctx, idx);\n"
+                        "\tif (!duk_is_array(ctx, idx)) {\n"
+                        "\t\treturn duk_error(ctx, DUK_ERR_ERROR, %s_error_fmt_sequence_type, argi, argname);\n"
+                        "\t}\n"
+                        "\tseqc = duk_get_length(ctx, idx);\n"
+                        "\tseq = duk_push_fixed_buffer(ctx, seqc * sizeof(*seq));\n"
+                        "\t/* ... arr@idx ... elements */\n"
+                        "\tfor (seqi = 0; seqi < seqc; seqi++) {\n"
+                        "\t\tduk_get_prop_index(ctx, idx, seqi);\n"
+                        "\t\tseq[seqi] = %s(ctx, -1);\n"
+                        "\t\tduk_pop(ctx);\n"
+                        "\t}\n"
+                        "\t*seq_out = seq;\n"
+                        "\treturn seqc;\n"
+                        "}\n"
+                        "\n",
+                        DLPFX, marshal->name, marshal->ctype,
+                        marshal->ctype,
+                        DLPFX,
+                        marshal->require);
+        }
+
+        return 0;
+}
+
+
+/**
+ * generate the profiling declarations for the binding header
+ *
+ * Each profiled function counts its calls in the profile table. When
+ * the generated code is built with DUKKY_PROFILE_TIME the time spent
+ * in each function is also accumulated.
+ */
+static int output_profile_declarations(struct opctx *outc)
+{
+        outputf(outc,
+                "\n/* Profiling */\n"
+                "#include <stdio.h>\n"
+                "\n"
+                "typedef struct %s_profile_entry {\n"
+                "\tconst char *interface;\n"
+                "\tconst char *kind;\n"
+                "\tconst char *member;\n"
+                "\tunsigned long calls;\n"
+                "\tunsigned long long nsec;\n"
+                "} %s_profile_entry_t;\n"
+                "\n"
+                "extern %s_profile_entry_t %s_profile_table[];\n"
+                "\n",
+                DLPFX, DLPFX, DLPFX, DLPFX);
+
+        outputf(outc,
+                "#ifdef DUKKY_PROFILE_TIME\n"
+                "#include <time.h>\n"
+                "\n"
+                "typedef struct %s_profile_sample {\n"
+                "\tint idx;\n"
+                "\tunsigned long long start;\n"
+                "} %s_profile_sample_t;\n"
+                "\n"
+                "static inline unsigned long long %s_profile_clock(void)\n"
+                "{\n"
+                "\tstruct timespec ts;\n"
+                "\tclock_gettime(CLOCK_MONOTONIC, &ts);\n"
+                "\treturn ((unsigned long long)ts.tv_sec * 1000000000ULL) + ts.tv_nsec;\n"
+                "}\n"
+                "\n"
+                "static inline void %s_profile_leave(%s_profile_sample_t *sample)\n"
+                "{\n"
+                "\t%s_profile_table[sample->idx].nsec += %s_profile_clock() - sample->start;\n"
+                "}\n"
+                "\n"
+                "#define DUKKY_PROFILE(IDX) \\\n"
+                "\t%s_profile_sample_t %s_profile_sample __attribute__((cleanup(%s_profile_leave))) = \\\n"
+                "\t\t{ (IDX), (%s_profile_table[(IDX)].calls++, %s_profile_clock()) }\n"
+                "#else\n"
+                "#define DUKKY_PROFILE(IDX) \\\n"
+                "\tunsigned long %s_profile_calls __attribute__((unused)) = %s_profile_table[(IDX)].calls++\n"
+                "#endif\n"
+                "\n"
+                "void %s_profile_dump(FILE *outf);\n",
+                DLPFX, DLPFX, DLPFX, DLPFX, DLPFX, DLPFX, DLPFX,
+                DLPFX, DLPFX, DLPFX, DLPFX, DLPFX,
+                DLPFX, DLPFX, DLPFX);
+
+        return 0;
+}
+
+/**
+ * test if an attribute can use the shared reflect accessors
+ *
+ * Attributes with a Reflect extended attribute and no implementation
+ *  in the binding reflect a content attribute. Only non nullable
+ *  string and boolean attributes of elements are reflected.
+ */
+static bool
+attribute_reflectable(struct ir *ir,
+                      struct ir_entry *interfacee,
+                      struct ir_attribute_entry *atributee)
+{
+        struct ir_entry *entry;
+
+        if ((atributee->reflect == NULL) ||
+            (atributee->getter != NULL) ||
+            (atributee->setter != NULL) ||
+            (atributee->putforwards != NULL) ||
+            (atributee->treatnullas != NULL) ||
+            (atributee->typec != 1) ||
+            (atributee->typev[0].nullable)) {
+                return false;
+        }
+
+        if ((atributee->typev[0].base != WEBIDL_TYPE_STRING) &&
+            (atributee->typev[0].base != WEBIDL_TYPE_BOOL)) {
+                return false;
+        }
+
+        /* content attributes are only present on elements */
+        for (entry = interfacee;
+             entry != NULL;
+             entry = ir_inherit_entry(ir, entry)) {
+                if (strcmp(entry->name, "Element") == 0) {
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+
+/**
+ * find the private member holding the dom node of an element
+ *
+ * The Element interface and its ancestors are searched for the first
+ *  class with a private member whose type is a dom_node or dom_element
+ *  pointer. The private of every element class begins with its
+ *  ancestors so the member is reached through that class private type.
+ *
+ * \return true if the member was found else false.
+ */
+static bool
+find_element_node_private(struct duk_libdom_ctx *dlctx, struct ir *ir)
+{
+        struct ir_entry *entry;
+        struct genbind_node *priv_node;
+        struct genbind_node *name_node;
+        const char *name;
+        int idx;
+
+        dlctx->reflect_class = NULL;
+        dlctx->reflect_member = NULL;
+
+        entry = NULL;
+        for (idx = 0; idx < ir->entryc; idx++) {
+                if ((ir->entries[idx].type == IR_ENTRY_TYPE_INTERFACE) &&
+                    (strcmp(ir->entries[idx].name, "Element") == 0)) {
+                        entry = ir->entries + idx;
+                        break;
+                }
+        }
+
+        for (; entry != NULL; entry = ir_inherit_entry(ir, entry)) {
+                priv_node = genbind_node_find_type(
+                        genbind_node_getnode(entry->class),
+                        NULL,
+                        GENBIND_NODE_TYPE_PRIVATE);
+                while (priv_node != NULL) {
+                        name_node = genbind_node_find_type(
+                                genbind_node_getnode(priv_node),
+                                NULL,
+                                GENBIND_NODE_TYPE_NAME);
+                        while (name_node != NULL) {
+                                name = genbind_node_gettext(name_node);
+                                if ((strcmp(name, "dom_node") == 0) ||
+                                    (strcmp(name, "dom_element") == 0)) {
+                                        dlctx->reflect_class = entry->class_name;
+                                        dlctx->reflect_member = genbind_node_gettext(
+                                                genbind_node_find_type(
+                                                        genbind_node_getnode(priv_node),
+                                                        NULL,
+                                                        GENBIND_NODE_TYPE_IDENT));
+                                        return true;
+                                }
+                                name_node = genbind_node_find_type(
+                                        genbind_node_getnode(priv_node),
+                                        name_node,
+                                        GENBIND_NODE_TYPE_NAME);
+                        }
+                        priv_node = genbind_node_find_type(
+                                genbind_node_getnode(entry->class),
+                                priv_node,
+                                GENBIND_NODE_TYPE_PRIVATE);
+                }
+        }
+
+        return false;
+}
+
+/**
+ * assign the shared reflect accessor magic to reflected attributes
+ *
+ * Attributes are only reflected when the binding gives elements a dom
+ *  node private member for the shared accessors to read.
+ */
+static int assign_reflect_magic(struct duk_libdom_ctx *dlctx, struct ir *ir)
+{
+        const char **newv;
+        int idx;
+        int attrc;
+        int nameidx;
+        bool element_private;
+
+        dlctx->reflectc = 0;
+
+        element_private = find_element_node_private(dlctx, ir);
+
+        for (idx = 0; idx < ir->entryc; idx++) {
+                struct ir_entry *interfacee;
+
+                interfacee = ir->entries + idx;
+                if (interfacee->type != IR_ENTRY_TYPE_INTERFACE) {
+                        continue;
+                }
+
+                for (attrc = 0;
+                     attrc < interfacee->u.interface.attributec;
+                     attrc++) {
+                        struct ir_attribute_entry *atributee;
+
+                        atributee = interfacee->u.interface.attributev + attrc;
+                        atributee->reflect_magic = 0;
+
+                        if (!attribute_reflectable(ir, interfacee, atributee)) {
+                                continue;
+                        }
+
+                        if (!element_private) {
+                                WARN(WARNING_UNIMPLEMENTED,
+                                     "Reflected attribute %s:%s needs a dom_node private member on Element or an ancestor",
+                                     interfacee->name,
+                                     atributee->name);
+                                continue;
+                        }
+
+                        /* each content attribute name is listed once */
+                        for (nameidx = 0; nameidx < dlctx->reflectc; nameidx++) {
+                                if (strcmp(dlctx->reflectv[nameidx],
+                                           atributee->reflect) == 0) {
+                                        break;
+                                }
+                        }
+
+                        if (nameidx == dlctx->reflectc) {
+                                if (dlctx->reflectc >= MAGIC_MAX) {
+                                        continue;
+                                }
+                                newv = realloc(dlctx->reflectv,
+                                               (dlctx->reflectc + 1) * sizeof(char *));
+                                if (newv == NULL) {
+                                        return -1;
+                                }
+                                dlctx->reflectv = newv;
+                                dlctx->reflectv[dlctx->reflectc++] = atributee->reflect;
+                        }
+
+                        atributee->reflect_magic = nameidx + 1;
+                }
+        }
+
+        return 0;
+}
+
+
+/**
+ * add a function to the profile table
+ *
+ * \return The index of the functions profiling counter or -1 on
+ *         allocation error.
+ */
+static int
+add_profile_entry(struct duk_libdom_ctx *dlctx,
+                  const char *interface,
+                  const char *kind,
+                  const char *member)
+{
+        struct profile_entry *newv;
+
+        newv = realloc(dlctx->profilev, (dlctx->profilec + 1) * sizeof(struct profile_entry));
+        if (newv == NULL) {
+                return -1;
+        }
+        dlctx->profilev = newv;
+        dlctx->profilev[dlctx->profilec].interface = interface;
+        dlctx->profilev[dlctx->profilec].kind = kind;
+        dlctx->profilev[dlctx->profilec].member = member;
+
+        return dlctx->profilec++;
+}
+
+
+/**
+ * generate the placement attribute of a function of a given temperature
+ */
+static void
+output_placement(struct opctx *outc, enum profile_temperature temperature)
+{
+        switch (temperature) {
+        case PROFILE_HOT:
+                outputf(outc, "DUKKY_HOT\n");
+                break;
+
+        case PROFILE_COLD:
+                outputf(outc, "DUKKY_COLD\n");
+                break;
+
+        default:
+                break;
+        }
+}
+
+
+/**
+ * get the temperature of a shared reflect accessor
+ *
+ * An accessor is as hot as the hottest content attribute it is called
+ *  for in the call profile.
+ */
+static enum profile_temperature
+reflect_accessor_temperature(struct duk_libdom_ctx *dlctx,
+                             struct ir *ir,
+                             bool boolean,
+                             const char *kind)
 {
+        enum profile_temperature temperature = PROFILE_COLD;
+        enum profile_temperature attribute_temperature;
         int idx;
-        struct opctx *privc;
+        int attrc;
 
-        /* open header */
-        privc = open_header(ir, "private");
+        if (dlctx->callprofile == NULL) {
+                return PROFILE_WARM;
+        }
 
         for (idx = 0; idx < ir->entryc; idx++) {
                 struct ir_entry *interfacee;
-                struct ir_entry *inherite;
-                struct genbind_node *priv_node;
 
                 interfacee = ir->entries + idx;
-
-                /* do not generate private structs for interfaces marked no
-                 * output
-                 */
-                if ((interfacee->type == IR_ENTRY_TYPE_INTERFACE) &&
-                    (interfacee->u.interface.noobject)) {
+                if (interfacee->type != IR_ENTRY_TYPE_INTERFACE) {
                         continue;
                 }
 
-                switch (interfacee->type) {
-                case IR_ENTRY_TYPE_INTERFACE:
-                        outputf(privc,
-                                "/* Private data for %s interface */\n",
-                                interfacee->name);
-                        break;
-
-                case IR_ENTRY_TYPE_DICTIONARY:
-                        outputf(privc,
-                                "/* Private data for %s dictionary */\n",
-                                interfacee->name);
-                        break;
-                }
+                for (attrc = 0;
+                     attrc < interfacee->u.interface.attributec;
+                     attrc++) {
+                        struct ir_attribute_entry *atributee;
 
-                outputf(privc,
-                        "typedef struct {\n");
+                        atributee = interfacee->u.interface.attributev + attrc;
+                        if ((atributee->reflect_magic == 0) ||
+                            ((atributee->typev[0].base == WEBIDL_TYPE_BOOL) != boolean)) {
+                                continue;
+                        }
+                        if ((strcmp(kind, "setter") == 0) &&
+                            (atributee->modifier == WEBIDL_TYPE_MODIFIER_READONLY)) {
+                                continue;
+                        }
 
-                /* find parent entry and include in private */
-                inherite = ir_inherit_entry(ir, interfacee);
-                if (inherite != NULL) {
-                        outputf(privc,
-                                "\t%s_private_t parent;\n",
-                                inherite->class_name);
+                        attribute_temperature = profile_temperature(
+                                dlctx->callprofile,
+                                REFLECT_PROFILE_NAME,
+                                kind,
+                                dlctx->reflectv[atributee->reflect_magic - 1]);
+                        if (attribute_temperature < temperature) {
+                                temperature = attribute_temperature;
+                        }
                 }
+        }
 
-                /* for each private variable on the class output it here. */
-                priv_node = genbind_node_find_type(
-                        genbind_node_getnode(interfacee->class),
-                        NULL,
-                        GENBIND_NODE_TYPE_PRIVATE);
-                while (priv_node != NULL) {
-                        outputc(privc, '\t');
-
-                        output_ctype(privc, priv_node, true);
+        return temperature;
+}
 
-                        outputf(privc, ";\n");
 
-                        priv_node = genbind_node_find_type(
-                                genbind_node_getnode(interfacee->class),
-                                priv_node,
-                                GENBIND_NODE_TYPE_PRIVATE);
-                }
+/**
+ * generate the start of a shared reflect accessor
+ *
+ * The profiling counter is selected by the accessor magic as each
+ *  content attribute has its own getter and setter counters.
+ */
+static void
+output_reflect_accessor_start(struct opctx *outc,
+                              struct ir *ir,
+                              bool boolean,
+                              const char *kind)
+{
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
 
-                outputf(privc,
-                        "} __attribute__((aligned)) %s_private_t;\n\n",
-                        interfacee->class_name);
-        }
+        output_placement(outc,
+                         reflect_accessor_temperature(dlctx, ir, boolean, kind));
 
-        close_header(ir, privc);
+        outputf(outc,
+                "duk_ret_t %s_reflect_%s_%s(duk_context *ctx)\n"
+                "{\n",
+                DLPFX, boolean ? "bool" : "string", kind);
 
-        return 0;
+        if (options->profile) {
+                outputf(outc,
+                        "\tDUKKY_PROFILE(%d + duk_get_current_magic(ctx));\n",
+                        dlctx->reflect_profile - 1 +
+                        ((strcmp(kind, "setter") == 0) ? dlctx->reflectc : 0));
+        }
 }
 
+
 /**
- * generate prototype header
+ * generate the shared reflect accessors and content attribute names
+ *
+ * The names are interned as dom strings when the prototypes are
+ *  created so the accessors only index the table with their magic.
  */
-static int
-output_prototype_header(struct ir *ir)
+static int output_reflect_accessors(struct opctx *outc, struct ir *ir)
 {
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
         int idx;
-        struct opctx *protoc;
 
-        /* open header */
-        protoc = open_header(ir, "prototype");
+        if (options->profile) {
+                /* getter counters of each content attribute then setters */
+                dlctx->reflect_profile = dlctx->profilec;
+                for (idx = 0; idx < dlctx->reflectc; idx++) {
+                        if (add_profile_entry(dlctx,
+                                              REFLECT_PROFILE_NAME,
+                                              "getter",
+                                              dlctx->reflectv[idx]) < 0) {
+                                return -1;
+                        }
+                }
+                for (idx = 0; idx < dlctx->reflectc; idx++) {
+                        if (add_profile_entry(dlctx,
+                                              REFLECT_PROFILE_NAME,
+                                              "setter",
+                                              dlctx->reflectv[idx]) < 0) {
+                                return -1;
+                        }
+                }
+        }
 
-        for (idx = 0; idx < ir->entryc; idx++) {
-                struct ir_entry *entry;
+        outputf(outc,
+                "\n/* Content attributes reflected by the shared accessors */\n"
+                "static const char *%s_reflect_names[%d] = {\n"
+                "\tNULL,\n",
+                DLPFX, dlctx->reflectc + 1);
+        for (idx = 0; idx < dlctx->reflectc; idx++) {
+                outputf(outc, "\t\"%s\",\n", dlctx->reflectv[idx]);
+        }
+        outputf(outc,
+                "};\n"
+                "\n"
+                "static dom_string *%s_reflect_strings[%d];\n"
+                "\n",
+                DLPFX, dlctx->reflectc + 1);
 
-                entry = ir->entries + idx;
+        outputf(outc,
+                "static void %s_intern_reflect_names(void)\n"
+                "{\n"
+                "\tint namei;\n"
+                "\tfor (namei = 1; namei < %d; namei++) {\n"
+                "\t\tif (%s_reflect_strings[namei] != NULL) continue;\n"
+                "\t\tdom_string_create_interned(\n"
+                "\t\t\t(const uint8_t *)%s_reflect_names[namei],\n"
+                "\t\t\tstrlen(%s_reflect_names[namei]),\n"
+                "\t\t\t&%s_reflect_strings[namei]);\n"
+                "\t}\n"
+                "}\n"
+                "\n",
+                DLPFX, dlctx->reflectc + 1, DLPFX, DLPFX, DLPFX, DLPFX);
 
-                switch (entry->type) {
-                case IR_ENTRY_TYPE_INTERFACE:
-                        output_interface_declaration(protoc, entry);
-                        break;
+        outputf(outc,
+                "static dom_element *%s_reflect_element(duk_context *ctx, dom_string **name)\n"
+                "{\n"
+                "\t%s_private_t *priv;\n"
+                "\tduk_push_this(ctx);\n"
+                "\tduk_get_prop_string(ctx, -1, %s_magic_string_private);\n"
+                "\tpriv = duk_get_pointer(ctx, -1);\n"
+                "\tduk_pop_2(ctx);\n"
+                "\t*name = %s_reflect_strings[duk_get_current_magic(ctx)];\n"
+                "\tif ((priv == NULL) || (*name == NULL)) {\n"
+                "\t\treturn NULL;\n"
+                "\t}\n"
+                "\treturn (dom_element *)priv->%s;\n"
+                "}\n"
+                "\n",
+                DLPFX, dlctx->reflect_class, DLPFX, DLPFX,
+                dlctx->reflect_member);
+
+        output_reflect_accessor_start(outc, ir, false, "getter");
+        outputf(outc,
+                "\tdom_element *element;\n"
+                "\tdom_string *name;\n"
+                "\tdom_string *value = NULL;\n"
+                "\telement = %s_reflect_element(ctx, &name);\n"
+                "\tif (element == NULL) return 0;\n"
+                "\tif (dom_element_get_attribute(element, name, &value) != DOM_NO_ERR) {\n"
+                "\t\treturn 0;\n"
+                "\t}\n"
+                "\tif (value != NULL) {\n"
+                "\t\tduk_push_lstring(ctx, dom_string_data(value), dom_string_length(value));\n"
+                "\t\tdom_string_unref(value);\n"
+                "\t} else {\n"
+                "\t\tduk_push_lstring(ctx, NULL, 0);\n"
+                "\t}\n"
+                "\treturn 1;\n"
+                "}\n"
+                "\n",
+                DLPFX);
 
-                case IR_ENTRY_TYPE_DICTIONARY:
-                        output_dictionary_declaration(protoc, entry);
-                        break;
-                }
-        }
+        output_reflect_accessor_start(outc, ir, false, "setter");
+        outputf(outc,
+                "\tdom_element *element;\n"
+                "\tdom_string *name;\n"
+                "\tdom_string *value;\n"
+                "\tduk_size_t slen;\n"
+                "\tconst char *s;\n"
+                "\telement = %s_reflect_element(ctx, &name);\n"
+                "\tif (element == NULL) return 0;\n"
+                "\ts = duk_safe_to_lstring(ctx, 0, &slen);\n"
+                "\tif (dom_string_create((const uint8_t *)s, slen, &value) != DOM_NO_ERR) {\n"
+                "\t\treturn 0;\n"
+                "\t}\n"
+                "\tdom_element_set_attribute(element, name, value);\n"
+                "\tdom_string_unref(value);\n"
+                "\treturn 0;\n"
+                "}\n"
+                "\n",
+                DLPFX);
 
-        close_header(ir, protoc);
+        output_reflect_accessor_start(outc, ir, true, "getter");
+        outputf(outc,
+                "\tdom_element *element;\n"
+                "\tdom_string *name;\n"
+                "\tbool present = false;\n"
+                "\telement = %s_reflect_element(ctx, &name);\n"
+                "\tif (element == NULL) return 0;\n"
+                "\tif (dom_element_has_attribute(element, name, &present) != DOM_NO_ERR) {\n"
+                "\t\treturn 0;\n"
+                "\t}\n"
+                "\tduk_push_boolean(ctx, present);\n"
+                "\treturn 1;\n"
+                "}\n"
+                "\n",
+                DLPFX);
+
+        output_reflect_accessor_start(outc, ir, true, "setter");
+        outputf(outc,
+                "\tdom_element *element;\n"
+                "\tdom_string *name;\n"
+                "\tdom_string *value;\n"
+                "\telement = %s_reflect_element(ctx, &name);\n"
+                "\tif (element == NULL) return 0;\n"
+                "\tif (duk_to_boolean(ctx, 0)) {\n"
+                "\t\tif (dom_string_create((const uint8_t *)\"\", 0, &value) != DOM_NO_ERR) {\n"
+                "\t\t\treturn 0;\n"
+                "\t\t}\n"
+                "\t\tdom_element_set_attribute(element, name, value);\n"
+                "\t\tdom_string_unref(value);\n"
+                "\t} else {\n"
+                "\t\tdom_element_remove_attribute(element, name);\n"
+                "\t}\n"
+                "\treturn 0;\n"
+                "}\n"
+                "\n",
+                DLPFX);
 
         return 0;
 }
 
 /**
- * generate makefile fragment
+ * generate the shared unimplemented member stub and its member names
  */
-static int
-output_makefile(struct ir *ir)
+static int output_unimplemented_stub(struct opctx *outc)
 {
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
         int idx;
-        FILE *makef;
 
-        /* open output file */
-        makef = genb_fopen_tmp("Makefile");
-        if (makef == NULL) {
-                return -1;
+        if (options->dbglog) {
+                outputf(outc,
+                        "\n/* Names of unimplemented members by magic */\n"
+                        "static const char *%s_unimplemented_names[] = {\n"
+                        "\t\"(unknown)\",\n",
+                        DLPFX);
+                for (idx = 0; idx < dlctx->unimplementedc; idx++) {
+                        outputf(outc, "\t\"%s\",\n", dlctx->unimplementedv[idx]);
+                }
+                outputf(outc, "};\n");
         }
 
-        fprintf(makef, "# duk libdom makefile fragment\n\n");
+        outputf(outc,
+                "\n/* Shared stub of every unimplemented member */\n"
+                "duk_ret_t %s_unimplemented(duk_context *ctx)\n"
+                "{\n",
+                DLPFX);
+        if (options->dbglog) {
+                outputf(outc,
+                        "\tNSLOG(dukky, WARNING, \"Unimplemented %%s\",\n"
+                        "\t      %s_unimplemented_names[duk_get_current_magic(ctx)]);\n",
+                        DLPFX);
+        } else {
+                outputf(outc, "\t(void)ctx;\n");
+        }
+        outputf(outc,
+                "\treturn 0;\n"
+                "}\n");
 
-        fprintf(makef, "NSGENBIND_SOURCES:=binding.c ");
-        for (idx = 0; idx < ir->entryc; idx++) {
-                struct ir_entry *interfacee;
+        return 0;
+}
 
-                interfacee = ir->entries + idx;
+/**
+ * generate the function placement declarations for the binding header
+ */
+static int output_placement_declarations(struct opctx *outc)
+{
+        outputf(outc,
+                "\n/* Function placement from call profile */\n"
+                "#if defined(__GNUC__)\n"
+                "#define DUKKY_HOT __attribute__((hot))\n"
+                "#define DUKKY_COLD __attribute__((cold))\n"
+                "#else\n"
+                "#define DUKKY_HOT\n"
+                "#define DUKKY_COLD\n"
+                "#endif\n");
 
-                /* no source for interfaces marked no output */
-                if ((interfacee->type == IR_ENTRY_TYPE_INTERFACE) &&
-                    (interfacee->u.interface.noobject)) {
-                        continue;
-                }
+        return 0;
+}
+
+/**
+ * generate the profile table and the function to report it
+ */
+static int output_profile_table(struct opctx *outc)
+{
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
+        int idx;
 
-                fprintf(makef, "%s ", interfacee->filename);
+        outputf(outc,
+                "\n/* Profile of each generated function */\n"
+                "#include <stdlib.h>\n"
+                "\n"
+                "%s_profile_entry_t %s_profile_table[] = {\n",
+                DLPFX, DLPFX);
+        for (idx = 0; idx < dlctx->profilec; idx++) {
+                if (dlctx->profilev[idx].member != NULL) {
+                        outputf(outc,
+                                "\t{ \"%s\", \"%s\", \"%s\", 0, 0 },\n",
+                                dlctx->profilev[idx].interface,
+                                dlctx->profilev[idx].kind,
+                                dlctx->profilev[idx].member);
+                } else {
+                        outputf(outc,
+                                "\t{ \"%s\", \"%s\", NULL, 0, 0 },\n",
+                                dlctx->profilev[idx].interface,
+                                dlctx->profilev[idx].kind);
+                }
         }
-        fprintf(makef, "\nNSGENBIND_PREFIX:=%s\n", options->outdirname);
+        outputf(outc,
+                "\t{ NULL, NULL, NULL, 0, 0 }\n"
+                "};\n\n");
 
-        genb_fclose_tmp(makef, "Makefile");
+        outputf(outc,
+                "static int %s_profile_cmp(const void *a, const void *b)\n"
+                "{\n"
+                "\tconst %s_profile_entry_t *ea = *(%s_profile_entry_t * const *)a;\n"
+                "\tconst %s_profile_entry_t *eb = *(%s_profile_entry_t * const *)b;\n"
+                "\tif (ea->calls == eb->calls) return 0;\n"
+                "\treturn (ea->calls < eb->calls) ? 1 : -1;\n"
+                "}\n\n",
+                DLPFX, DLPFX, DLPFX, DLPFX, DLPFX);
+
+        outputf(outc,
+                "void %s_profile_dump(FILE *outf)\n"
+                "{\n"
+                "\t%s_profile_entry_t *sorted[%d];\n"
+                "\tint idx;\n"
+                "\n"
+                "\tfor (idx = 0; idx < %d; idx++) {\n"
+                "\t\tsorted[idx] = &%s_profile_table[idx];\n"
+                "\t}\n"
+                "\tqsort(sorted, %d, sizeof(sorted[0]), %s_profile_cmp);\n"
+                "\n"
+                "\tfprintf(outf, \"%%12s %%16s %%s\\n\", \"calls\", \"nsec\", \"function\");\n"
+                "\tfor (idx = 0; idx < %d; idx++) {\n"
+                "\t\tif (sorted[idx]->calls == 0) break;\n"
+                "\t\tfprintf(outf, \"%%12lu %%16llu %%s%%s%%s %%s\\n\",\n"
+                "\t\t\tsorted[idx]->calls, sorted[idx]->nsec,\n"
+                "\t\t\tsorted[idx]->interface,\n"
+                "\t\t\t(sorted[idx]->member != NULL) ? \"::\" : \"\",\n"
+                "\t\t\t(sorted[idx]->member != NULL) ? sorted[idx]->member : \"\",\n"
+                "\t\t\tsorted[idx]->kind);\n"
+                "\t}\n"
+                "}\n",
+                DLPFX, DLPFX, dlctx->profilec + 1, dlctx->profilec, DLPFX,
+                dlctx->profilec, DLPFX, dlctx->profilec);
 
         return 0;
 }
 
-
 /**
  * generate binding header
  *
@@ -278,12 +1429,12 @@ output_makefile(struct ir *ir)
  * the primary global (if any) generated last.
  */
 static int
-output_binding_header(struct ir *ir)
+output_binding_header(struct duk_libdom_ctx *dlctx, struct ir *ir)
 {
         struct opctx *bindc;
 
         /* open header */
-        bindc = open_header(ir, "binding");
+        bindc = open_header(dlctx, ir, "binding");
 
         outputf(bindc,
                 "#define _MAGIC(S) (\"%s\" S)\n"
@@ -305,18 +1456,48 @@ output_binding_header(struct ir *ir)
                 "extern const char *%s_error_fmt_argument;\n"
                 "extern const char *%s_error_fmt_bool_type;\n"
                 "extern const char *%s_error_fmt_number_type;\n"
+                "extern const char *%s_error_fmt_sequence_type;\n"
                 "extern const char *%s_magic_string_private;\n"
                 "extern const char *%s_magic_string_prototypes;\n"
+                "extern const char *%s_magic_string_keys;\n"
                 "\n",
-                DLPFX, DLPFX, DLPFX, DLPFX, DLPFX);
+                DLPFX, DLPFX, DLPFX, DLPFX, DLPFX, DLPFX, DLPFX);
+
+        output_key_declarations(bindc, ir);
 
         outputf(bindc,
                 "duk_bool_t %s_instanceof(duk_context *ctx, duk_idx_t index, const char *klass);\n",
                 DLPFX);
 
+        output_sequence_helper_declarations(bindc);
+
         outputf(bindc,
                 "duk_ret_t %s_create_prototypes(duk_context *ctx);\n", DLPFX);
 
+        if (options->profile) {
+                output_profile_declarations(bindc);
+        }
+
+        if (dlctx->callprofile != NULL) {
+                output_placement_declarations(bindc);
+        }
+
+        if (options->sharedstubs) {
+                outputf(bindc,
+                        "duk_ret_t %s_unimplemented(duk_context *ctx);\n",
+                        DLPFX);
+        }
+
+        if (dlctx->reflectc > 0) {
+                outputf(bindc,
+                        "\n/* Shared accessors of reflected content attributes */\n"
+                        "duk_ret_t %s_reflect_string_getter(duk_context *ctx);\n"
+                        "duk_ret_t %s_reflect_string_setter(duk_context *ctx);\n"
+                        "duk_ret_t %s_reflect_bool_getter(duk_context *ctx);\n"
+                        "duk_ret_t %s_reflect_bool_setter(duk_context *ctx);\n",
+                        DLPFX, DLPFX, DLPFX, DLPFX);
+        }
+
         close_header(ir, bindc);
 
         return 0;
@@ -330,35 +1511,23 @@ output_binding_header(struct ir *ir)
  * implementations.
  */
 static int
-output_binding_src(struct ir *ir)
+output_binding_src(struct duk_libdom_ctx *dlctx, struct ir *ir)
 {
         int idx;
         struct ir_entry *pglobale = NULL;
         char *proto_name;
         struct opctx *bindc;
+        int keyc;
         int res;
 
         /* open the output binding file */
-        res = output_open("binding.c", &bindc);
+        res = output_open(dlctx->outdirname, "binding.c", dlctx, &bindc);
         if (res != 0 ) {
                 return -1;
         }
 
-        /* tool preface */
-        output_tool_preface(bindc);
-
-        /* binding preface */
-        output_method_cdata(bindc,
-                            ir->binding_node,
-                            GENBIND_METHOD_TYPE_PREFACE);
-
-        /* tool prologue */
-        output_tool_prologue(bindc);
-
-        /* binding prologue */
-        output_method_cdata(bindc,
-                            ir->binding_node,
-                            GENBIND_METHOD_TYPE_PROLOGUE);
+        /* prefaces and prologues */
+        output_source_preamble(bindc, ir, NULL);
 
         outputc(bindc, '\n');
 
@@ -366,16 +1535,18 @@ output_binding_src(struct ir *ir)
                 "/* Error format strings */\n"
                 "const char *%s_error_fmt_argument =\"%%d argument required, but ony %%d present.\";\n"
                 "const char *%s_error_fmt_bool_type =\"argument %%d (%%s) requires a bool\";\n"
-                "const char *%s_error_fmt_number_type =\"argument %%d (%%s) requires a number\";\n",
-                DLPFX, DLPFX, DLPFX);
+                "const char *%s_error_fmt_number_type =\"argument %%d (%%s) requires a number\";\n"
+                "const char *%s_error_fmt_sequence_type =\"argument %%d (%%s) requires a sequence\";\n",
+                DLPFX, DLPFX, DLPFX, DLPFX);
 
         outputf(bindc, "\n");
 
         outputf(bindc,
                 "/* Magic identifiers */\n"
                 "const char *%s_magic_string_private =\"%sPRIVATE\";\n"
-                "const char *%s_magic_string_prototypes =\"%sPROTOTYPES\";\n",
-                DLPFX, MAGICPFX, DLPFX, MAGICPFX);
+                "const char *%s_magic_string_prototypes =\"%sPROTOTYPES\";\n"
+                "const char *%s_magic_string_keys =\"%sKEYS\";\n",
+                DLPFX, MAGICPFX, DLPFX, MAGICPFX, DLPFX, MAGICPFX);
 
         outputf(bindc, "\n");
 
@@ -415,6 +1586,18 @@ output_binding_src(struct ir *ir)
                 "\n",
                 DLPFX, DLPFX);
 
+        keyc = output_keys(bindc, ir);
+
+        output_sequence_helpers(bindc);
+
+        if (dlctx->reflectc > 0) {
+                res = output_reflect_accessors(bindc, ir);
+                if (res != 0) {
+                        output_close(bindc);
+                        return res;
+                }
+        }
+
         /* prototype creation helper function */
         outputf(bindc,
                 "static duk_ret_t\n"
@@ -475,6 +1658,14 @@ output_binding_src(struct ir *ir)
 
         outputf(bindc, "{\n");
 
+        if (keyc > 0) {
+                outputf(bindc, "\t%s_intern_keys(ctx);\n\n", DLPFX);
+        }
+
+        if (dlctx->reflectc > 0) {
+                outputf(bindc, "\t%s_intern_reflect_names();\n\n", DLPFX);
+        }
+
         for (idx = 0; idx < ir->entryc; idx++) {
                 struct ir_entry *interfacee;
 
@@ -528,6 +1719,14 @@ output_binding_src(struct ir *ir)
 
         outputf(bindc, "}\n");
 
+        if (options->profile) {
+                output_profile_table(bindc);
+        }
+
+        if (options->sharedstubs) {
+                output_unimplemented_stub(bindc);
+        }
+
         /* binding postface */
         output_method_cdata(bindc,
                             ir->binding_node,
@@ -538,7 +1737,139 @@ output_binding_src(struct ir *ir)
         return 0;
 }
 
-static int output_interfaces_dictionaries(struct ir *ir)
+/* exported interface documented in duk-libdom.h */
+int output_profile_entry(struct opctx *outc,
+                         struct ir_entry *interfacee,
+                         const char *kind,
+                         const char *member)
+{
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
+        int idx;
+
+        if (!options->profile) {
+                return 0;
+        }
+
+        idx = add_profile_entry(dlctx, interfacee->name, kind, member);
+        if (idx < 0) {
+                return -1;
+        }
+
+        outputf(outc, "\tDUKKY_PROFILE(%d);\n", idx);
+
+        return 0;
+}
+
+/* exported interface documented in duk-libdom.h */
+int output_unimplemented_magic(struct opctx *outc,
+                               struct ir_entry *interfacee,
+                               const char *kind,
+                               const char *member)
+{
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
+        char **newv;
+        int namelen;
+
+        /* the magic only identifies the member in debug logging */
+        if ((!options->dbglog) || (dlctx->unimplementedc >= MAGIC_MAX)) {
+                return 0;
+        }
+
+        newv = realloc(dlctx->unimplementedv,
+                       (dlctx->unimplementedc + 1) * sizeof(char *));
+        if (newv == NULL) {
+                return -1;
+        }
+        dlctx->unimplementedv = newv;
+
+        namelen = strlen(interfacee->name) + strlen(member) + strlen(kind) + 4;
+        dlctx->unimplementedv[dlctx->unimplementedc] = malloc(namelen);
+        if (dlctx->unimplementedv[dlctx->unimplementedc] == NULL) {
+                return -1;
+        }
+        snprintf(dlctx->unimplementedv[dlctx->unimplementedc], namelen, "%s::%s %s",
+                 interfacee->name, member, kind);
+
+        dlctx->unimplementedc++;
+
+        outputf(outc, "\tduk_set_magic(ctx, -1, %d);\n", dlctx->unimplementedc);
+
+        return 0;
+}
+
+/* exported interface documented in duk-libdom.h */
+enum profile_temperature
+output_member_temperature(struct opctx *outc,
+                          struct ir_entry *interfacee,
+                          const char *kind,
+                          const char *member,
+                          bool implemented)
+{
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
+
+        if (dlctx->callprofile == NULL) {
+                return PROFILE_WARM;
+        }
+
+        if (!implemented) {
+                return PROFILE_COLD;
+        }
+
+        return profile_temperature(dlctx->callprofile,
+                                   interfacee->name,
+                                   kind,
+                                   member);
+}
+
+/* exported interface documented in duk-libdom.h */
+void output_member_placement(struct opctx *outc,
+                             struct ir_entry *interfacee,
+                             const char *kind,
+                             const char *member,
+                             bool implemented)
+{
+        output_placement(outc,
+                         output_member_temperature(outc,
+                                                   interfacee,
+                                                   kind,
+                                                   member,
+                                                   implemented));
+}
+
+/* exported interface documented in duk-libdom.h */
+void output_member_cost_start(struct opctx *outc)
+{
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
+
+        if (dlctx->costc != NULL) {
+                output_cost_start(outc);
+        }
+}
+
+/* exported interface documented in duk-libdom.h */
+void output_member_cost_record(struct opctx *outc,
+                               struct ir_entry *interfacee,
+                               const char *kind,
+                               const char *name)
+{
+        struct duk_libdom_ctx *dlctx = output_priv(outc);
+        struct output_cost cost;
+
+        if (dlctx->costc == NULL) {
+                return;
+        }
+
+        output_cost_stop(outc, &cost);
+
+        outputf(dlctx->costc,
+                "%-32s %-8s %-32s %6u %6u %6u %6u %6u %6u\n",
+                interfacee->name, kind, name,
+                cost.lines, cost.calls, cost.lookups,
+                cost.pushes, cost.allocs, cost.strings);
+}
+
+static int
+output_interfaces_dictionaries(struct duk_libdom_ctx *dlctx, struct ir *ir)
 {
         int res;
         int idx;
@@ -555,7 +1886,7 @@ static int output_interfaces_dictionaries(struct ir *ir)
                          * output
                          */
                         if (!irentry->u.interface.noobject) {
-                                res = output_interface(ir, irentry);
+                                res = output_interface(dlctx, ir, irentry);
                                 if (res != 0) {
                                         return res;
                                 }
@@ -563,7 +1894,7 @@ static int output_interfaces_dictionaries(struct ir *ir)
                         break;
 
                 case IR_ENTRY_TYPE_DICTIONARY:
-                        res = output_dictionary(ir, irentry);
+                        res = output_dictionary(dlctx, ir, irentry);
                         if (res != 0) {
                                 return res;
                         }
@@ -576,11 +1907,63 @@ static int output_interfaces_dictionaries(struct ir *ir)
         return 0;
 }
 
-int duk_libdom_output(struct ir *ir)
+/* exported interface documented in duk-libdom.h */
+int duk_libdom_ctx_new(const char *outdirname, struct duk_libdom_ctx **dlctx_out)
+{
+        struct duk_libdom_ctx *dlctx;
+
+        dlctx = calloc(1, sizeof(struct duk_libdom_ctx));
+        if (dlctx == NULL) {
+                return -1;
+        }
+        dlctx->outdirname = outdirname;
+
+        *dlctx_out = dlctx;
+
+        return 0;
+}
+
+/* exported interface documented in duk-libdom.h */
+void duk_libdom_ctx_free(struct duk_libdom_ctx *dlctx)
+{
+        int idx;
+
+        if (dlctx == NULL) {
+                return;
+        }
+        for (idx = 0; idx < dlctx->unimplementedc; idx++) {
+                free(dlctx->unimplementedv[idx]);
+        }
+        free(dlctx->unimplementedv);
+        free(dlctx->profilev);
+        free(dlctx->reflectv);
+        profile_free(dlctx->callprofile);
+        free(dlctx);
+}
+
+/* exported interface documented in duk-libdom.h */
+int duk_libdom_output(struct duk_libdom_ctx *dlctx, struct ir *ir)
 {
         int idx;
         int res = 0;
 
+        /* profiled functions are numbered as the interfaces are output */
+        dlctx->profilec = 0;
+
+        /* as are the members using the shared stub */
+        for (idx = 0; idx < dlctx->unimplementedc; idx++) {
+                free(dlctx->unimplementedv[idx]);
+        }
+        dlctx->unimplementedc = 0;
+
+        /* the call profile is read again for each output as it may change */
+        if (options->profilefile != NULL) {
+                res = profile_load(options->profilefile, &dlctx->callprofile);
+                if (res != 0) {
+                        return res;
+                }
+        }
+
         /* process ir entries for output */
         for (idx = 0; idx < ir->entryc; idx++) {
                 struct ir_entry *irentry;
@@ -603,39 +1986,109 @@ int duk_libdom_output(struct ir *ir)
                 }
         }
 
-        res = output_interfaces_dictionaries(ir);
+        /* reflected attributes share accessors indexed by their magic */
+        res = assign_reflect_magic(dlctx, ir);
+        if (res != 0) {
+                goto output_err;
+        }
+
+        stats_phase_start(STATS_PHASE_OUTPUT_INTERFACES);
+        /* the cost of each interface member is reported as it is output */
+        if (options->costreport) {
+                res = output_open(dlctx->outdirname,
+                                  "cost-report",
+                                  dlctx,
+                                  &dlctx->costc);
+                if (res != 0) {
+                        goto output_err;
+                }
+                outputf(dlctx->costc,
+                        "# %-30s %-8s %-32s %6s %6s %6s %6s %6s %6s\n",
+                        "interface", "kind", "member",
+                        "lines", "calls", "lookup", "push", "alloc", "string");
+        }
+
+        res = output_interfaces_dictionaries(dlctx, ir);
+
+        if (dlctx->costc != NULL) {
+                output_close(dlctx->costc);
+                dlctx->costc = NULL;
+        }
+        stats_phase_stop(STATS_PHASE_OUTPUT_INTERFACES);
         if (res != 0) {
                 goto output_err;
         }
 
+        /* generate class headers */
+        if (options->splitheaders) {
+                stats_phase_start(STATS_PHASE_OUTPUT_CLASS_HEADERS);
+                res = output_class_headers(dlctx, ir);
+                stats_phase_stop(STATS_PHASE_OUTPUT_CLASS_HEADERS);
+                if (res != 0) {
+                        goto output_err;
+                }
+        }
+
         /* generate private header */
-        res = output_private_header(ir);
+        stats_phase_start(STATS_PHASE_OUTPUT_PRIVATE);
+        res = output_private_header(dlctx, ir);
+        stats_phase_stop(STATS_PHASE_OUTPUT_PRIVATE);
         if (res != 0) {
                 goto output_err;
         }
 
         /* generate prototype header */
-        res = output_prototype_header(ir);
+        stats_phase_start(STATS_PHASE_OUTPUT_PROTOTYPE);
+        res = output_prototype_header(dlctx, ir);
+        stats_phase_stop(STATS_PHASE_OUTPUT_PROTOTYPE);
         if (res != 0) {
                 goto output_err;
         }
 
+        /* generate common header */
+        if (options->commonheader) {
+                stats_phase_start(STATS_PHASE_OUTPUT_COMMON_HEADER);
+                res = output_common_header(dlctx, ir);
+                stats_phase_stop(STATS_PHASE_OUTPUT_COMMON_HEADER);
+                if (res != 0) {
+                        goto output_err;
+                }
+        }
+
         /* generate binding header */
-        res = output_binding_header(ir);
+        stats_phase_start(STATS_PHASE_OUTPUT_BINDING_HEADER);
+        res = output_binding_header(dlctx, ir);
+        stats_phase_stop(STATS_PHASE_OUTPUT_BINDING_HEADER);
         if (res != 0) {
                 goto output_err;
         }
 
         /* generate binding source */
-        res = output_binding_src(ir);
+        stats_phase_start(STATS_PHASE_OUTPUT_BINDING_SOURCE);
+        res = output_binding_src(dlctx, ir);
+        stats_phase_stop(STATS_PHASE_OUTPUT_BINDING_SOURCE);
         if (res != 0) {
                 goto output_err;
         }
 
+        /* generate unity build shards */
+        if (options->shards > 0) {
+                stats_phase_start(STATS_PHASE_OUTPUT_SHARDS);
+                res = output_shards(dlctx, ir, options->shards);
+                stats_phase_stop(STATS_PHASE_OUTPUT_SHARDS);
+                if (res != 0) {
+                        goto output_err;
+                }
+        }
+
         /* generate makefile fragment */
-        res = output_makefile(ir);
+        stats_phase_start(STATS_PHASE_OUTPUT_MAKEFILE);
+        res = output_makefile(dlctx, ir);
+        stats_phase_stop(STATS_PHASE_OUTPUT_MAKEFILE);
 
 output_err:
+        profile_free(dlctx->callprofile);
+        dlctx->callprofile = NULL;
 
         return res;
 }
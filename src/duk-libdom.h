@@ -9,23 +9,194 @@
 #ifndef nsgenbind_duk_libdom_h
 #define nsgenbind_duk_libdom_h
 
+/** a generated function with a profiling counter */
+struct profile_entry {
+        const char *interface; /**< interface name */
+        const char *kind; /**< kind of function */
+        const char *member; /**< member name or NULL */
+};
+
+/**
+ * duktape and libdom binding generation context
+ *
+ * Every output context of a binding is opened with its generation
+ *  context as the private data.
+ */
+struct duk_libdom_ctx {
+        const char *outdirname; /**< directory output is generated in */
+
+        /** cost report output context if one is being generated */
+        struct opctx *costc;
+
+        /** functions with profiling counters in the order of their counters */
+        struct profile_entry *profilev;
+        int profilec;
+
+        /** call profile guiding function placement if one was given */
+        struct profile *callprofile;
+
+        /**
+         * names of members using the shared stub in the order of their
+         *  magic
+         *
+         * Members are numbered from one, zero is left for members beyond
+         *  the range of magic values.
+         */
+        char **unimplementedv;
+        int unimplementedc;
+
+        /**
+         * content attribute names reflected by the shared reflect accessors
+         *
+         * The accessor magic value is the index of the name plus one.
+         */
+        const char **reflectv;
+        int reflectc;
+
+        /**
+         * class and member of the private which holds the dom node of
+         *  an element, the shared reflect accessors read the element
+         *  from it.
+         */
+        const char *reflect_class;
+        const char *reflect_member;
+
+        /**
+         * profiling counter of the first content attribute getter
+         *
+         * The shared accessors select their counter with their magic,
+         *  the setter counters follow the getters.
+         */
+        int reflect_profile;
+};
+
+/**
+ * create a binding generation context
+ *
+ * \param outdirname The directory output is generated in, it must
+ *                   remain valid for the life of the context.
+ * \param dlctx_out Updated with the new context.
+ * \return 0 on success else -1 on allocation error.
+ */
+int duk_libdom_ctx_new(const char *outdirname, struct duk_libdom_ctx **dlctx_out);
+
+/**
+ * free a binding generation context
+ */
+void duk_libdom_ctx_free(struct duk_libdom_ctx *dlctx);
+
 /**
  * Generate output for duktape and libdom bindings.
+ *
+ * \param dlctx The generation context of the binding.
+ * \param ir The intermediate representation of the binding tree.
  */
-int duk_libdom_output(struct ir *ir);
+int duk_libdom_output(struct duk_libdom_ctx *dlctx, struct ir *ir);
 
 /**
  * generate a source file to implement an interface using duk and libdom.
  *
+ * \param dlctx The generation context of the binding.
  * \param ir The intermediate representation of the binding tree.
  * \param interfacee The interface entry to output within the ir.
  */
-int output_interface(struct ir *ir, struct ir_entry *interfacee);
+int output_interface(struct duk_libdom_ctx *dlctx, struct ir *ir, struct ir_entry *interfacee);
 
 /**
  * generate a source file to implement a dictionary using duk and libdom.
  */
-int output_dictionary(struct ir *ir, struct ir_entry *dictionarye);
+int output_dictionary(struct duk_libdom_ctx *dlctx, struct ir *ir, struct ir_entry *dictionarye);
+
+/**
+ * generate unity build shards of the interface and dictionary sources
+ *
+ * Each shard includes the sources of its interfaces with parents
+ *  before their children. A single shard includes the binding source
+ *  as well to amalgamate the whole binding.
+ *
+ * \param dlctx The generation context of the binding.
+ * \param ir The intermediate representation of the binding tree.
+ * \param shardc The number of shards to generate.
+ * \return 0 on success or -1 on error.
+ */
+int output_shards(struct duk_libdom_ctx *dlctx, struct ir *ir, int shardc);
+
+/**
+ * generate the profiling counter of a function
+ *
+ * Does nothing unless profiling is enabled. The function is added to
+ *  the profile table generated in the binding source.
+ *
+ * \param outc The output context the function is output to.
+ * \param interfacee The interface the function belongs to.
+ * \param kind The kind of function.
+ * \param member The name of the member or NULL.
+ * \return 0 on success or -1 on allocation error.
+ */
+int output_profile_entry(struct opctx *outc, struct ir_entry *interfacee, const char *kind, const char *member);
+
+/**
+ * generate the magic identifying a member using the shared stub
+ *
+ * Members which are unimplemented use a single shared stub function
+ *  instead of a generated function. When debug logging is generated
+ *  the function magic identifies the member for the log. The shared
+ *  stub function must be on the top of the duk stack.
+ *
+ * \param outc The output context the prototype is output to.
+ * \param interfacee The interface the member belongs to.
+ * \param kind The kind of member.
+ * \param member The name of the member.
+ * \return 0 on success or -1 on allocation error.
+ */
+int output_unimplemented_magic(struct opctx *outc, struct ir_entry *interfacee, const char *kind, const char *member);
+
+/**
+ * get the temperature of a generated function from the call profile
+ *
+ * Without a call profile every function is warm. With one,
+ *  unimplemented functions are cold along with those never called.
+ *
+ * \param outc The output context the function is output to.
+ * \param interfacee The interface the function belongs to.
+ * \param kind The kind of function.
+ * \param member The name of the member or NULL.
+ * \param implemented false if the function is an unimplemented stub.
+ * \return The function temperature.
+ */
+enum profile_temperature output_member_temperature(struct opctx *outc, struct ir_entry *interfacee, const char *kind, const char *member, bool implemented);
+
+/**
+ * generate the placement attribute of a function from the call profile
+ *
+ * Hot functions are marked to be optimised for speed and placed
+ *  together, cold functions are optimised for size and placed away
+ *  from the rest. Does nothing without a call profile.
+ *
+ * \param outc The output context the function is output to.
+ * \param interfacee The interface the function belongs to.
+ * \param kind The kind of function.
+ * \param member The name of the member or NULL.
+ * \param implemented false if the function is an unimplemented stub.
+ */
+void output_member_placement(struct opctx *outc, struct ir_entry *interfacee, const char *kind, const char *member, bool implemented);
+
+/**
+ * start estimating the cost of an interface member
+ *
+ * Does nothing unless a cost report is being generated.
+ */
+void output_member_cost_start(struct opctx *outc);
+
+/**
+ * add the estimated cost of an interface member to the cost report
+ *
+ * \param outc The output context the member was output to.
+ * \param interfacee The interface the member belongs to.
+ * \param kind The kind of member.
+ * \param name The name of the member.
+ */
+void output_member_cost_record(struct opctx *outc, struct ir_entry *interfacee, const char *kind, const char *name);
 
 /**
  * generate a declaration to implement a dictionary using duk and libdom.
@@ -34,8 +205,12 @@ int output_interface_declaration(struct opctx *outc, struct ir_entry *interfacee
 
 /**
  * generate a declaration to implement a dictionary using duk and libdom.
+ *
+ * \param outc The output context.
+ * \param ir The intermediate representation of the binding tree.
+ * \param dictionarye The dictionary entry to output within the ir.
  */
-int output_dictionary_declaration(struct opctx *outc, struct ir_entry *dictionarye);
+int output_dictionary_declaration(struct opctx *outc, struct ir *ir, struct ir_entry *dictionarye);
 
 /**
  * generate preface block for nsgenbind
@@ -43,9 +218,33 @@ int output_dictionary_declaration(struct opctx *outc, struct ir_entry *dictionar
 int output_tool_preface(struct opctx *outc);
 
 /**
- * generate preface block for nsgenbind
+ * generate prologue block for nsgenbind
+ *
+ * \param outc The output context.
+ * \param entry The ir entry the source implements or NULL for the binding.
+ */
+int output_tool_prologue(struct opctx *outc, struct ir_entry *entry);
+
+/**
+ * generate the preamble of a generated source
+ *
+ * The preamble is the tool preface, the binding and class prefaces, the
+ *  tool prologue and the binding and class prologues. With a common
+ *  header the blocks shared by every source are included from it first.
+ *
+ * \param outc The output context.
+ * \param ir The intermediate representation of the binding tree.
+ * \param entry The ir entry the source implements or NULL for the binding.
  */
-int output_tool_prologue(struct opctx *outc);
+int output_source_preamble(struct opctx *outc, struct ir *ir, struct ir_entry *entry);
+
+/**
+ * generate an include of the header of an ir entry class
+ *
+ * \param outc The output context.
+ * \param entry The ir entry.
+ */
+int output_class_include(struct opctx *outc, struct ir_entry *entry);
 
 /**
  * output character data of node of given type.
@@ -114,6 +313,13 @@ int output_ctype(struct opctx *outc, struct genbind_node *node, bool identifier)
  */
 char *gen_idl2c_name(const char *idlname);
 
+/**
+ * Get the prefix of interned property key identifiers.
+ *
+ * The prefix is the upper case binding prefix followed by _KEY_
+ */
+const char *gen_key_prefix(void);
+
 /**
  * Generate class property setter for a single attribute.
  */
@@ -124,5 +330,36 @@ int output_generated_attribute_setter(struct opctx *outc, struct ir_entry *inter
  */
 int output_generated_attribute_getter(struct opctx *outc, struct ir_entry *interfacee, struct ir_attribute_entry *atributee);
 
+/**
+ * Marshalling description for one C element type of a sequence.
+ */
+struct sequence_marshal {
+        const char *name; /**< helper name suffix */
+        const char *ctype; /**< C type separated ready for an identifier */
+        const char *push; /**< duktape push call for an element */
+        const char *require; /**< duktape call reading an element */
+};
+
+/**
+ * table of sequence element marshalling terminated by a NULL name.
+ */
+extern const struct sequence_marshal sequence_marshalv[];
+
+/**
+ * get the marshalling for sequence elements of a webidl type.
+ *
+ * \param type The base type of the sequence elements.
+ * \return The marshalling entry or NULL if the element type is not handled.
+ */
+const struct sequence_marshal *get_sequence_marshal(enum webidl_type type);
+
+/**
+ * get the element type of a sequence or array type node.
+ *
+ * \param type_node The webidl type node to examine.
+ * \param element_type Updated with the base type of the elements.
+ * \return true if the type is a sequence or array else false.
+ */
+bool get_sequence_element_type(struct webidl_node *type_node, enum webidl_type *element_type);
 
 #endif
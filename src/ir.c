@@ -281,6 +281,7 @@ operation_map_new(struct webidl_node *interface,
         struct ir_operation_entry *cure; /* current entry */
         struct ir_operation_entry *operationv;
         int operationc;
+        int allocc;
 
         /* enumerate operationss including overloaded members */
         operationc = enumerate_interface_type(interface,
@@ -299,6 +300,7 @@ operation_map_new(struct webidl_node *interface,
                 return -1;
         };
         cure = operationv;
+        allocc = operationc;
 
         /* iterate each list node within the interface */
         list_node = webidl_node_find_type(
@@ -371,6 +373,19 @@ operation_map_new(struct webidl_node *interface,
                         WEBIDL_NODE_TYPE_LIST);
         }
 
+        /* overloads of unnamed operations can be left on entries past
+         * the shortened list which are never seen again
+         */
+        for (cure = operationv + operationc;
+             cure < operationv + allocc;
+             cure++) {
+                int ovidx;
+                for (ovidx = 0; ovidx < cure->overloadc; ovidx++) {
+                        free(cure->overloadv[ovidx].argumentv);
+                }
+                free(cure->overloadv);
+        }
+
         *operationc_out = operationc;
         *operationv_out = operationv; /* resulting operations map */
 
@@ -428,6 +443,74 @@ get_extended_value(struct webidl_node *node, const char *key)
 }
 
 
+/**
+ * test for an extended attribute
+ */
+static bool
+has_extended_attribute(struct webidl_node *node, const char *key)
+{
+        char *ident;
+        struct webidl_node *ext_attr;
+
+        ext_attr = webidl_node_find_type(
+                webidl_node_getnode(node),
+                NULL,
+                WEBIDL_NODE_TYPE_EXTENDED_ATTRIBUTE);
+        while (ext_attr != NULL) {
+                ident = webidl_node_gettext(
+                        webidl_node_find_type(
+                                webidl_node_getnode(ext_attr),
+                                NULL,
+                                WEBIDL_NODE_TYPE_IDENT));
+
+                if ((ident != NULL) && (strcmp(ident, key) == 0)) {
+                        return true;
+                }
+
+                ext_attr = webidl_node_find_type(
+                        webidl_node_getnode(node),
+                        ext_attr,
+                        WEBIDL_NODE_TYPE_EXTENDED_ATTRIBUTE);
+        }
+
+        return false;
+}
+
+
+/**
+ * get the content attribute an attribute reflects
+ *
+ * The Reflect extended attribute may name the content attribute,
+ *  without a value the lower case attribute name is reflected.
+ *
+ * \return The content attribute name or NULL if not reflected.
+ */
+static const char *
+get_reflect_value(struct webidl_node *node, const char *name)
+{
+        char *value;
+        int idx;
+
+        /* the value is copied so the entry always owns its name */
+        value = get_extended_value(node, "Reflect");
+        if (value != NULL) {
+                return strdup(value);
+        }
+
+        if (!has_extended_attribute(node, "Reflect")) {
+                return NULL;
+        }
+
+        value = strdup(name);
+        if (value != NULL) {
+                for (idx = 0; value[idx] != 0; idx++) {
+                        value[idx] = tolower((unsigned char)value[idx]);
+                }
+        }
+        return value;
+}
+
+
 /**
  * Create IR entry for a type
  */
@@ -611,6 +694,9 @@ attribute_map_new(struct webidl_node *interface,
                         cure->treatnullas = get_extended_value(at_node,
                                                                "TreatNullAs");
 
+                        /* check for reflect extended attribute */
+                        cure->reflect = get_reflect_value(at_node, cure->name);
+
                         /* move to next attribute */
                         cure++;
 
@@ -991,6 +1077,76 @@ int ir_new(struct genbind_node *genbind,
         return 0;
 }
 
+/**
+ * free the operations of an interface entry
+ */
+static void
+operation_map_free(int operationc, struct ir_operation_entry *operationv)
+{
+        int opidx;
+        int ovidx;
+
+        for (opidx = 0; opidx < operationc; opidx++) {
+                struct ir_operation_entry *operatione = operationv + opidx;
+
+                for (ovidx = 0; ovidx < operatione->overloadc; ovidx++) {
+                        free(operatione->overloadv[ovidx].argumentv);
+                }
+                free(operatione->overloadv);
+        }
+        free(operationv);
+}
+
+/**
+ * free the attributes of an interface entry
+ */
+static void
+attribute_map_free(int attributec, struct ir_attribute_entry *attributev)
+{
+        int idx;
+
+        for (idx = 0; idx < attributec; idx++) {
+                free(attributev[idx].typev);
+                free((char *)attributev[idx].reflect);
+                free(attributev[idx].property_name);
+        }
+        free(attributev);
+}
+
+/* exported interface documented in ir.h */
+void ir_free(struct ir *map)
+{
+        struct ir_entry *entry;
+        int idx;
+
+        if (map == NULL) {
+                return;
+        }
+
+        for (idx = 0; idx < map->entryc; idx++) {
+                entry = map->entries + idx;
+
+                switch (entry->type) {
+                case IR_ENTRY_TYPE_INTERFACE:
+                        operation_map_free(entry->u.interface.operationc,
+                                           entry->u.interface.operationv);
+                        attribute_map_free(entry->u.interface.attributec,
+                                           entry->u.interface.attributev);
+                        free(entry->u.interface.constantv);
+                        break;
+
+                case IR_ENTRY_TYPE_DICTIONARY:
+                        free(entry->u.dictionary.memberv);
+                        break;
+                }
+
+                free(entry->filename);
+                free(entry->class_name);
+        }
+        free(map->entries);
+        free(map);
+}
+
 static int ir_dump_dictionary(FILE *dumpf, struct ir_entry *ecur)
 {
         if (ecur->u.dictionary.memberc > 0) {
@@ -1128,7 +1284,7 @@ static int ir_dump_interface(FILE *dumpf, struct ir_entry *ecur)
         return 0;
 }
 
-int ir_dump(struct ir *ir)
+int ir_dump(const char *outdirname, struct ir *ir)
 {
         FILE *dumpf;
         int eidx;
@@ -1139,7 +1295,7 @@ int ir_dump(struct ir *ir)
                 return 0;
         }
 
-        dumpf = genb_fopen("ir-map", "w");
+        dumpf = genb_fopen(outdirname, "ir-map", "w");
         if (dumpf == NULL) {
                 return 2;
         }
@@ -1172,7 +1328,7 @@ int ir_dump(struct ir *ir)
         return 0;
 }
 
-int ir_dumpdot(struct ir *index)
+int ir_dumpdot(const char *outdirname, struct ir *index)
 {
         FILE *dumpf;
         int eidx;
@@ -1183,7 +1339,7 @@ int ir_dumpdot(struct ir *index)
                 return 0;
         }
 
-        dumpf = genb_fopen("ir.dot", "w");
+        dumpf = genb_fopen(outdirname, "ir.dot", "w");
         if (dumpf == NULL) {
                 return 2;
         }
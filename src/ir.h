@@ -70,6 +70,7 @@ struct ir_attribute_entry {
         enum webidl_type_modifier modifier; /**< modifier for the attribute intself */
         const char *putforwards; /**< putforwards attribute */
         const char *treatnullas; /**< treatnullas attribute */
+        const char *reflect; /**< content attribute reflected or NULL */
 
         struct genbind_node *getter; /**< getter from binding */
         struct genbind_node *setter; /**< getter from binding */
@@ -79,6 +80,9 @@ struct ir_attribute_entry {
                               * might lowercase the name or add underscores
                               * instead of caps
                               */
+        int reflect_magic; /**< magic of the shared reflect accessors used
+                            * for the attribute or zero if it has its own
+                            */
 };
 
 /**
@@ -179,9 +183,16 @@ int ir_new(struct genbind_node *genbind,
                       struct webidl_node *webidl,
                       struct ir **map_out);
 
-int ir_dump(struct ir *map);
+/**
+ * free an interface map
+ *
+ * The AST nodes the map refers to are not freed.
+ */
+void ir_free(struct ir *map);
+
+int ir_dump(const char *outdirname, struct ir *map);
 
-int ir_dumpdot(struct ir *map);
+int ir_dumpdot(const char *outdirname, struct ir *map);
 
 /**
  * interface map parent entry
@@ -19,6 +19,7 @@
 #include "utils.h"
 #include "nsgenbind-ast.h"
 #include "options.h"
+#include "stats.h"
 
 /**
  * standard IO handle for parse trace logging.
@@ -27,9 +28,13 @@ static FILE *genbind_parsetracef;
 
 /* parser and lexer interface */
 extern int nsgenbind_debug;
-extern int nsgenbind__flex_debug;
-extern void nsgenbind_restart(FILE*);
-extern int nsgenbind_parse(char *filename, struct genbind_node **genbind_ast);
+struct yy_buffer_state;
+extern int nsgenbind_lex_init(void **scanner);
+extern int nsgenbind_lex_destroy(void *scanner);
+extern void nsgenbind_set_debug(int debug_flag, void *scanner);
+extern void nsgenbind_set_lineno(int line_number, void *scanner);
+extern struct yy_buffer_state *nsgenbind__scan_buffer(char *base, size_t size, void *scanner);
+extern int nsgenbind_parse(void *scanner, char *filename, struct genbind_node **genbind_ast);
 
 /* terminal nodes have a value only */
 struct genbind_node {
@@ -101,16 +106,48 @@ genbind_node_add(struct genbind_node *node, struct genbind_node *list)
 	return node;
 }
 
-char *genbind_strapp(char *a, char *b)
+/* exported interface documented in nsgenbind-ast.h */
+struct genbind_strbuf *
+genbind_strbuf_append(struct genbind_strbuf *strbuf, char *text)
 {
-        char *fullstr;
-        int fulllen;
-        fulllen = strlen(a) + strlen(b) + 1;
-        fullstr = malloc(fulllen);
-        snprintf(fullstr, fulllen, "%s%s", a, b);
-        free(a);
-        free(b);
-        return fullstr;
+        size_t textlen;
+
+        textlen = strlen(text);
+
+        if (strbuf == NULL) {
+                /* first chunk becomes the initial buffer */
+                strbuf = calloc(1, sizeof(struct genbind_strbuf));
+                strbuf->text = text;
+                strbuf->len = textlen;
+                strbuf->alloc = textlen + 1;
+                return strbuf;
+        }
+
+        if ((strbuf->len + textlen + 1) > strbuf->alloc) {
+                /* grow geometrically so total copying is linear */
+                strbuf->alloc *= 2;
+                if (strbuf->alloc < (strbuf->len + textlen + 1)) {
+                        strbuf->alloc = strbuf->len + textlen + 1;
+                }
+                strbuf->text = realloc(strbuf->text, strbuf->alloc);
+        }
+
+        memcpy(strbuf->text + strbuf->len, text, textlen + 1);
+        strbuf->len += textlen;
+        free(text);
+
+        return strbuf;
+}
+
+/* exported interface documented in nsgenbind-ast.h */
+char *genbind_strbuf_finish(struct genbind_strbuf *strbuf)
+{
+        char *text;
+
+        text = strbuf->text;
+        free(strbuf);
+
+        return text;
 }
 
 struct genbind_node *
@@ -126,6 +163,7 @@ genbind_new_node(enum genbind_node_type type, struct genbind_node *l, void *r)
 {
         struct genbind_node *nn;
         nn = calloc(1, sizeof(struct genbind_node));
+        stats_node(STATS_AST_GENBIND, type, 1, sizeof(struct genbind_node));
         nn->type = type;
         nn->l = l;
         nn->r.value = r;
@@ -139,6 +177,7 @@ genbind_new_number_node(enum genbind_node_type type,
 {
         struct genbind_node *nn;
         nn = calloc(1, sizeof(struct genbind_node));
+        stats_node(STATS_AST_GENBIND, type, 1, sizeof(struct genbind_node));
         nn->type = type;
         nn->l = l;
         nn->r.number = number;
@@ -402,7 +441,8 @@ int *genbind_node_getint(struct genbind_node *node)
         return NULL;
 }
 
-static const char *genbind_node_type_to_str(enum genbind_node_type type)
+/* exported interface documented in nsgenbind-ast.h */
+const char *genbind_node_type_to_str(enum genbind_node_type type)
 {
         switch(type) {
         case GENBIND_NODE_TYPE_IDENT:
@@ -456,6 +496,9 @@ static const char *genbind_node_type_to_str(enum genbind_node_type type)
         case GENBIND_NODE_TYPE_CDATA:
                 return "CBlock";
 
+        case GENBIND_NODE_TYPE_MODIFIER:
+                return "Modifier";
+
         default:
                 return "Unknown";
         }
@@ -493,7 +536,23 @@ static int genbind_ast_dump(FILE *dfile, struct genbind_node *node, int indent)
 
 
 /* exported interface documented in nsgenbind-ast.h */
-int genbind_dump_ast(struct genbind_node *node)
+void genbind_ast_free(struct genbind_node *node)
+{
+        struct genbind_node *next;
+
+        while (node != NULL) {
+                next = node->l;
+                genbind_ast_free(genbind_node_getnode(node));
+                if (node->type == GENBIND_NODE_TYPE_CDATA) {
+                        free(node->r.text);
+                }
+                free(node);
+                node = next;
+        }
+}
+
+/* exported interface documented in nsgenbind-ast.h */
+int genbind_dump_ast(const char *outdirname, struct genbind_node *node)
 {
         FILE *dumpf;
 
@@ -502,7 +561,7 @@ int genbind_dump_ast(struct genbind_node *node)
                 return 0;
         }
 
-        dumpf = genb_fopen("binding-ast", "w");
+        dumpf = genb_fopen(outdirname, "binding-ast", "w");
         if (dumpf == NULL) {
                 return 2;
         }
@@ -581,9 +640,14 @@ FILE *genbindopen(const char *filename)
 }
 
 
-int genbind_parsefile(char *infilename, struct genbind_node **ast)
+int genbind_parsefile(char *infilename,
+                      const char *outdirname,
+                      struct genbind_node **ast)
 {
         FILE *infile;
+        char *inmap;
+        size_t inmapsize;
+        void *scanner;
         int ret;
 
         /* open input file */
@@ -595,20 +659,42 @@ int genbind_parsefile(char *infilename, struct genbind_node **ast)
                 return 3;
         }
 
+        inmap = genb_fmap(infile, &inmapsize);
+        if (inmap == NULL) {
+                fprintf(stderr, "Error reading %s: %s\n",
+                        infilename,
+                        strerror(errno));
+                return 3;
+        }
+
+        if (nsgenbind_lex_init(&scanner) != 0) {
+                genb_funmap(inmap, inmapsize);
+                return 3;
+        }
+
         /* if debugging enabled enable parser tracing and send to file */
         if (options->debug) {
                 nsgenbind_debug = 1;
-                nsgenbind__flex_debug = 1;
-                genbind_parsetracef = genb_fopen("binding-trace", "w");
+                nsgenbind_set_debug(1, scanner);
+                genbind_parsetracef = genb_fopen(outdirname,
+                                                 "binding-trace",
+                                                 "w");
         } else {
                 genbind_parsetracef = NULL;
         }
 
-        /* set flex to read from file */
-        nsgenbind_restart(infile);
+        /* set flex to scan the mapped file, the buffer state is deleted
+         * when the end of file rule pops it or by nsgenbind_lex_destroy()
+         * if the parse stops early
+         */
+        nsgenbind__scan_buffer(inmap, inmapsize, scanner);
+        nsgenbind_set_lineno(1, scanner);
 
         /* process binding */
-        ret = nsgenbind_parse(infilename, ast);
+        ret = nsgenbind_parse(scanner, infilename, ast);
+
+        nsgenbind_lex_destroy(scanner);
+        genb_funmap(inmap, inmapsize);
 
         /* close tracefile if open */
         if (genbind_parsetracef != NULL) {
@@ -67,9 +67,52 @@ int genbind_cmp_node_type(struct genbind_node *node, void *ctx);
 
 FILE *genbindopen(const char *filename);
 
-int genbind_parsefile(char *infilename, struct genbind_node **ast);
+/**
+ * parse a binding file into an AST
+ *
+ * \param infilename The binding file.
+ * \param outdirname The directory debug output is written to.
+ * \param ast Updated with the AST.
+ * \return 0 on success or non zero on faliure.
+ */
+int genbind_parsefile(char *infilename, const char *outdirname, struct genbind_node **ast);
+
+/**
+ * free a binding AST
+ *
+ * All text other than the character data, including string literals,
+ * keywords and file names, is interned by the scanner and parser so
+ * only the character data is freed with the nodes.
+ *
+ * \param node The root of the AST.
+ */
+void genbind_ast_free(struct genbind_node *node);
+
+/**
+ * growable string used to accumulate character data
+ */
+struct genbind_strbuf {
+        char *text; /**< the accumulated text */
+        size_t len; /**< length of the text */
+        size_t alloc; /**< allocated size of the text */
+};
 
-char *genbind_strapp(char *a, char *b);
+/**
+ * append text to a string buffer
+ *
+ * \param strbuf The buffer to append to or NULL to create a new buffer.
+ * \param text The text to append, ownership passes to the buffer.
+ * \return The string buffer.
+ */
+struct genbind_strbuf *genbind_strbuf_append(struct genbind_strbuf *strbuf, char *text);
+
+/**
+ * finish with a string buffer
+ *
+ * \param strbuf The buffer to finish.
+ * \return The accumulated text which the caller owns.
+ */
+char *genbind_strbuf_finish(struct genbind_strbuf *strbuf);
 
 /**
  * create a new node with value from pointer
@@ -95,10 +138,16 @@ struct genbind_node *genbind_node_add(struct genbind_node *node, struct genbind_
  * If the debug flag has been set this causes the binding AST to be written to
  * a binding-ast output file
  *
+ * \param outdirname The directory to write the dump to.
  * \param node Node of the tree to start dumping from (usually tree root)
  * \return 0 on sucess or non zero on faliure and error message printed.
  */
-int genbind_dump_ast(struct genbind_node *node);
+int genbind_dump_ast(const char *outdirname, struct genbind_node *node);
+
+/**
+ * get the name of a node type
+ */
+const char *genbind_node_type_to_str(enum genbind_node_type type);
 
 /**
  *Depth first left hand search using user provided comparison
@@ -91,24 +91,18 @@ typedef struct YYLTYPE {
 #include "webidl-ast.h"
 #include "nsgenbind-ast.h"
 
-static char *errtxt;
-
 static void nsgenbind_error(YYLTYPE *locp,
+                            void *scanner,
                             char *filename,
                             struct genbind_node **genbind_ast,
                             const char *str)
 {
-        int errlen;
-
+        UNUSED(scanner);
         UNUSED(genbind_ast);
         UNUSED(filename);
 
-        errlen = snprintf(NULL, 0, "%s:%d:%s",
-                          locp->filename, locp->first_line, str);
-        errtxt = malloc(errlen + 1);
-        snprintf(errtxt, errlen + 1, "%s:%d:%s",
-                          locp->filename, locp->first_line, str);
-
+        fprintf(stderr, "%s:%d:%s\n",
+                locp->filename, locp->first_line, str);
 }
 
 static struct genbind_node *
@@ -149,7 +143,8 @@ add_method(struct genbind_node **genbind_ast,
                                 genbind_new_number_node(GENBIND_NODE_TYPE_LINE,
                                                         cdata_node,
                                                         lineno),
-                                         strdup(filename));
+                                         genb_intern(filename,
+                                                     strlen(filename)));
 
         /* generate method node */
         method_node = genbind_new_node(GENBIND_NODE_TYPE_METHOD,
@@ -181,6 +176,8 @@ add_method(struct genbind_node **genbind_ast,
 
 }
 
+%lex-param { void *scanner }
+%parse-param { void *scanner }
 %parse-param { char *filename }
 %parse-param { struct genbind_node **genbind_ast }
 
@@ -188,6 +185,7 @@ add_method(struct genbind_node **genbind_ast,
 {
         char *text;
         struct genbind_node *node;
+        struct genbind_strbuf *strbuf;
         long value;
 }
 
@@ -226,6 +224,7 @@ add_method(struct genbind_node **genbind_ast,
 %token <text> TOK_CCODE_LITERAL
 
 %type <text> CBlock
+%type <strbuf> CCodeChunks
 
 %type <value> Modifiers
 %type <value> Modifier
@@ -272,8 +271,6 @@ Statements:
         |
         error ';'
         {
-                fprintf(stderr, "%s\n", errtxt);
-                free(errtxt);
                 YYABORT ;
         }
         ;
@@ -337,7 +334,7 @@ CTypeSpecifier:
                 $$ = genbind_new_node(GENBIND_NODE_TYPE_NAME,
                                       genbind_new_node(GENBIND_NODE_TYPE_NAME,
                                                        NULL,
-                                                       strdup("unsigned")),
+                                                       genb_intern("unsigned", SLEN("unsigned"))),
                                       $2);
         }
         |
@@ -346,7 +343,7 @@ CTypeSpecifier:
                 $$ = genbind_new_node(GENBIND_NODE_TYPE_NAME,
                                       genbind_new_node(GENBIND_NODE_TYPE_NAME,
                                                        NULL,
-                                                       strdup("struct")),
+                                                       genb_intern("struct", SLEN("struct"))),
                                       $2);
         }
         |
@@ -355,7 +352,7 @@ CTypeSpecifier:
                 $$ = genbind_new_node(GENBIND_NODE_TYPE_NAME,
                                       genbind_new_node(GENBIND_NODE_TYPE_NAME,
                                                        NULL,
-                                                       strdup("union")),
+                                                       genb_intern("union", SLEN("union"))),
                                       $2);
         }
         |
@@ -370,7 +367,7 @@ CType:
         |
         CTypeSpecifier '*'
         {
-                $$ = genbind_new_node(GENBIND_NODE_TYPE_NAME, $1, strdup("*"));
+                $$ = genbind_new_node(GENBIND_NODE_TYPE_NAME, $1, genb_intern("*", SLEN("*")));
         }
 
  /* type and identifier of a variable */
@@ -389,11 +386,22 @@ CTypeIdent:
 
 
 CBlock:
+        CCodeChunks
+        {
+          $$ = genbind_strbuf_finish($1);
+        }
+        ;
+
+ /* accumulate code chunks in linear time */
+CCodeChunks:
         TOK_CCODE_LITERAL
+        {
+          $$ = genbind_strbuf_append(NULL, $1);
+        }
         |
-        CBlock TOK_CCODE_LITERAL
+        CCodeChunks TOK_CCODE_LITERAL
         {
-          $$ = genbind_strapp($1, $2);
+          $$ = genbind_strbuf_append($1, $2);
         }
         ;
 
@@ -490,12 +498,12 @@ MethodName:
         |
         TOK_METHOD
         {
-                $$ = strdup("method");
+                $$ = genb_intern("method", SLEN("method"));
         }
         |
         TOK_TYPE
         {
-                $$ = strdup("type");
+                $$ = genb_intern("type", SLEN("type"));
         }
         ;
 
@@ -15,21 +15,11 @@
 #include <errno.h>
 
 #include "options.h"
-#include "nsgenbind-ast.h"
-#include "webidl-ast.h"
-#include "ir.h"
-#include "output.h"
-#include "jsapi-libdom.h"
-#include "duk-libdom.h"
+#include "pipeline.h"
+#include "stats.h"
 
 struct options *options;
 
-enum bindingtype_e {
-    BINDINGTYPE_UNKNOWN,
-    BINDINGTYPE_JSAPI_LIBDOM,
-    BINDINGTYPE_DUK_LIBDOM,
-};
-
 static struct options* process_cmdline(int argc, char **argv)
 {
         int opt;
@@ -40,12 +30,16 @@ static struct options* process_cmdline(int argc, char **argv)
                 return NULL;
         }
 
-        while ((opt = getopt(argc, argv, "vngDW::I:")) != -1) {
+        while ((opt = getopt(argc, argv, "vngwRPp:SHEFU:DW::T::I:C:")) != -1) {
                 switch (opt) {
                 case 'I':
                         options->idlpath = strdup(optarg);
                         break;
 
+                case 'C':
+                        options->idlcache = strdup(optarg);
+                        break;
+
                 case 'v':
                         options->verbose = true;
                         break;
@@ -54,6 +48,49 @@ static struct options* process_cmdline(int argc, char **argv)
                         options->dryrun = true;
                         break;
 
+                case 'w':
+                        options->watch = true;
+                        break;
+
+                case 'R':
+                        options->costreport = true;
+                        break;
+
+                case 'P':
+                        options->profile = true;
+                        break;
+
+                case 'p':
+                        options->profilefile = strdup(optarg);
+                        break;
+
+                case 'S':
+                        options->sharedstubs = true;
+                        break;
+
+                case 'E':
+                        options->commonheader = true;
+                        break;
+
+                case 'F':
+                        options->flatinit = true;
+                        break;
+
+                case 'H':
+                        options->splitheaders = true;
+                        break;
+
+                case 'U':
+                        options->shards = atoi(optarg);
+                        if (options->shards < 1) {
+                                fprintf(stderr,
+                                        "Invalid number of shards \"%s\"\n",
+                                        optarg);
+                                free(options);
+                                return NULL;
+                        }
+                        break;
+
                 case 'D':
                         options->debug = true;
                         break;
@@ -84,171 +121,83 @@ static struct options* process_cmdline(int argc, char **argv)
                         }
                         break;
 
+                case 'T':
+                        if (optarg == NULL) {
+                                options->stats = STATS_TEXT;
+                        } else if (strcmp(optarg, "json") == 0) {
+                                options->stats = STATS_JSON;
+                        } else {
+                                fprintf(stderr,
+                                        "Unknown statistics format \"%s\" valid formats are: json\n",
+                                        optarg);
+                                free(options);
+                                return NULL;
+                        }
+                        break;
+
                 default: /* '?' */
                         fprintf(stderr,
-                             "Usage: %s [-v] [-g] [-D] [-W] [-I idlpath] inputfile outputdir\n",
+                             "Usage: %s [-v] [-g] [-w] [-R] [-P] [-p profile] [-S] [-H] [-E] [-F] [-U shards] [-D] [-W] [-T[json]] [-I idlpath] [-C idlcache] inputfile outputdir [inputfile outputdir ...]\n",
                                 argv[0]);
                         free(options);
                         return NULL;
                 }
         }
 
-        if (optind > (argc - 2)) {
+        if ((optind > (argc - 2)) || (((argc - optind) % 2) != 0)) {
                 fprintf(stderr,
-                       "Error: expected input filename and output directory\n");
+                       "Error: expected input filename and output directory pairs\n");
                 free(options);
                 return NULL;
         }
 
-        options->infilename = strdup(argv[optind]);
-
-        options->outdirname = strdup(argv[optind + 1]);
+        options->bindingc = (argc - optind) / 2;
+        options->bindingv = &argv[optind];
 
         return options;
 
 }
 
-static int webidl_file_cb(struct genbind_node *node, void *ctx)
-{
-	struct webidl_node **webidl_ast = ctx;
-	char *filename;
-
-	filename = genbind_node_gettext(node);
-
-        if (options->verbose) {
-                printf("Opening IDL file \"%s\"\n", filename);
-        }
-
-	return webidl_parsefile(filename, webidl_ast);
-}
-
-static int genbind_load_idl(struct genbind_node *genbind,
-                            struct webidl_node **webidl_out)
-{
-        int res;
-        struct genbind_node *binding_node;
-
-        binding_node = genbind_node_find_type(genbind, NULL,
-                                              GENBIND_NODE_TYPE_BINDING);
-
-	/* walk AST and load any web IDL files required */
-	res = genbind_node_foreach_type(
-                genbind_node_getnode(binding_node),
-                GENBIND_NODE_TYPE_WEBIDL,
-                webidl_file_cb,
-                webidl_out);
-	if (res != 0) {
-		fprintf(stderr, "Error: failed reading Web IDL\n");
-		return -1;
-	}
-
-        /* implements are implemented as mixins so intercalate them */
-        res = webidl_intercalate_implements(*webidl_out);
-	if (res != 0) {
-		fprintf(stderr, "Error: Failed to intercalate implements\n");
-		return -1;
-	}
-
-        return 0;
-}
-
-/**
- * get the type of binding
- */
-static enum bindingtype_e genbind_get_type(struct genbind_node *node)
-{
-        struct genbind_node *binding_node;
-        const char *binding_type;
-
-        binding_node = genbind_node_find_type(node,
-                                              NULL,
-                                              GENBIND_NODE_TYPE_BINDING);
-        if (binding_node == NULL) {
-            /* binding entry is missing which is invalid */
-            return BINDINGTYPE_UNKNOWN;
-        }
-
-        binding_type = genbind_node_gettext(
-                genbind_node_find_type(
-                        genbind_node_getnode(binding_node),
-                        NULL,
-                        GENBIND_NODE_TYPE_NAME));
-        if (binding_type == NULL) {
-                fprintf(stderr, "Error: missing binding type\n");
-                return BINDINGTYPE_UNKNOWN;
-        }
-
-        if (strcmp(binding_type, "jsapi_libdom") == 0) {
-                return BINDINGTYPE_JSAPI_LIBDOM;
-        }
-
-        if (strcmp(binding_type, "duk_libdom") == 0) {
-                return BINDINGTYPE_DUK_LIBDOM;
-        }
-
-        fprintf(stderr, "Error: unsupported binding type \"%s\"\n", binding_type);
-
-        return BINDINGTYPE_UNKNOWN;
-}
-
 int main(int argc, char **argv)
 {
         int res;
-        struct genbind_node *genbind_root = NULL;
-        struct webidl_node *webidl_root = NULL;
-        struct ir *ir = NULL;
-        enum bindingtype_e bindingtype;
+        struct options *opts;
+        struct pipeline *pipeline;
+        int bidx;
 
-        options = process_cmdline(argc, argv);
-        if (options == NULL) {
+        opts = process_cmdline(argc, argv);
+        if (opts == NULL) {
                 return 1; /* bad commandline */
         }
 
-        /* parse binding */
-        res = genbind_parsefile(options->infilename, &genbind_root);
+        res = pipeline_new(opts, &pipeline);
         if (res != 0) {
-                fprintf(stderr, "Error: parse failed with code %d\n", res);
-                return res;
+                return 1;
         }
 
-        /* dump the binding AST */
-        genbind_dump_ast(genbind_root);
-
-        /* get type of binding */
-        bindingtype = genbind_get_type(genbind_root);
-        if (bindingtype == BINDINGTYPE_UNKNOWN) {
-                return 3;
-        }
-
-        /* load the IDL files specified in the binding */
-        res = genbind_load_idl(genbind_root, &webidl_root);
-        if (res != 0) {
-                return 4;
+        for (bidx = 0; bidx < opts->bindingc; bidx++) {
+                res = pipeline_add_binding(pipeline,
+                                           opts->bindingv[bidx * 2],
+                                           opts->bindingv[(bidx * 2) + 1]);
+                if (res != 0) {
+                        return 1;
+                }
         }
 
-	/* debug dump of web idl AST */
-        webidl_dump_ast(webidl_root);
-
-        /* generate intermediate representation */
-        res = ir_new(genbind_root, webidl_root, &ir);
+        res = pipeline_run(pipeline);
         if (res != 0) {
-                return 5;
+                return res;
         }
 
-        /* dump the intermediate representation */
-        ir_dump(ir);
-        ir_dumpdot(ir);
+        stats_report(stdout);
 
-        /* generate binding */
-        switch (bindingtype) {
-        case BINDINGTYPE_DUK_LIBDOM:
-                res = duk_libdom_output(ir);
-                break;
+        if (opts->watch) {
+                /* watching runs until killed so nothing may be left buffered */
+                fflush(stdout);
 
-        default:
-                fprintf(stderr, "Unable to generate binding of this type\n");
-                res = 7;
+                /* keep regenerating as the sources change */
+                return pipeline_watch(pipeline, 200);
         }
 
-        return res;
+        return 0;
 }
@@ -9,16 +9,28 @@
 #ifndef nsgenbind_options_h
 #define nsgenbind_options_h
 
-/** global options */
+/** global options from the command line, read only once parsed */
 struct options {
-	char *infilename; /**< binding source */
-	char *outdirname; /**< output directory */
 	char *idlpath; /**< path to IDL files */
+	char *idlcache; /**< IDL cache file */
+
+	int bindingc; /**< number of bindings */
+	char **bindingv; /**< binding source and output directory pairs */
 
 	bool verbose; /**< verbose processing */
 	bool debug; /**< debug enabled */
 	bool dbglog; /**< embed debug logging in output */
         bool dryrun; /**< output is not generated */
+        bool watch; /**< regenerate output when sources change */
+	unsigned int stats; /**< statistics report format */
+	bool costreport; /**< generate cost report of interface members */
+	bool profile; /**< generate profiling counters in output */
+	char *profilefile; /**< call profile guiding function placement */
+	bool sharedstubs; /**< unimplemented members use a shared stub */
+	int shards; /**< number of unity build shards or zero for none */
+	bool splitheaders; /**< generate a header for each class */
+	bool commonheader; /**< shared preamble is generated as a header */
+	bool flatinit; /**< ancestor init and fini code is generated inline */
 
 	unsigned int warnings; /**< warning flags */
 };
@@ -32,6 +44,12 @@ enum opt_warnings {
 	WARNING_GENERATED = 8,
 };
 
+enum opt_stats {
+	STATS_OFF = 0, /**< no statistics */
+	STATS_TEXT, /**< statistics reported as text */
+	STATS_JSON, /**< statistics reported as JSON */
+};
+
 #define WARNING_ALL (WARNING_UNIMPLEMENTED | WARNING_DUPLICATED | WARNING_WEBIDL)
 
 #define WARN(flags, msg, args...) do {			\
@@ -9,18 +9,120 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <stdbool.h>
 #include <string.h>
+#include <ctype.h>
 
 #include "utils.h"
 #include "output.h"
 
 struct opctx {
+    const char *dirname; /**< directory the file is output to */
     char *filename;
     FILE *outf;
     unsigned int lineno;
+    bool costing; /**< cost of output is being estimated */
+    struct output_cost cost; /**< estimated cost of output */
+    void *priv; /**< generator context */
+    /** buffer to hold formatted output so newlines can be counted */
+    char buffer[128*1024];
 };
 
-int output_open(const char *filename, struct opctx **opctx_out)
+/** functions which allocate from the heap */
+static const char *cost_alloc_calls[] = {
+        "malloc",
+        "calloc",
+        "realloc",
+        "strdup",
+        "strndup",
+        "duk_alloc",
+        "duk_push_object",
+        "duk_push_array",
+        "duk_push_buffer",
+        "duk_push_fixed_buffer",
+        "duk_push_dynamic_buffer",
+        NULL
+};
+
+static bool cost_has_suffix(const char *name, size_t len, const char *suffix)
+{
+        size_t slen = strlen(suffix);
+
+        return (len > slen) && (strncmp(name + len - slen, suffix, slen) == 0);
+}
+
+/**
+ * account for a function call in the cost of the output
+ */
+static void
+output_cost_call(struct output_cost *cost, const char *name, size_t len)
+{
+        int idx;
+
+        if ((len > 4) && (strncmp(name, "duk_", 4) == 0)) {
+                cost->calls++;
+
+                if ((len > 9) && (strncmp(name, "duk_push_", 9) == 0)) {
+                        cost->pushes++;
+                }
+
+                /* property accessed by string key which must be hashed */
+                if (cost_has_suffix(name, len, "_prop_string") ||
+                    cost_has_suffix(name, len, "_prop_lstring") ||
+                    cost_has_suffix(name, len, "_global_string") ||
+                    cost_has_suffix(name, len, "_global_lstring")) {
+                        cost->lookups++;
+                }
+        }
+
+        if ((len >= 17) && (strncmp(name, "dom_string_create", 17) == 0)) {
+                cost->strings++;
+        }
+
+        for (idx = 0; cost_alloc_calls[idx] != NULL; idx++) {
+                if ((strlen(cost_alloc_calls[idx]) == len) &&
+                    (strncmp(cost_alloc_calls[idx], name, len) == 0)) {
+                        cost->allocs++;
+                        break;
+                }
+        }
+}
+
+/**
+ * account for output text in the cost of the output
+ *
+ * Each identifier followed by an open bracket is a call.
+ */
+static void output_cost_scan(struct output_cost *cost, const char *text, int len)
+{
+        int idx = 0;
+        int start;
+
+        while (idx < len) {
+                if (text[idx] == '\n') {
+                        cost->lines++;
+                }
+                if (!isalpha((unsigned char)text[idx]) && (text[idx] != '_')) {
+                        idx++;
+                        continue;
+                }
+
+                start = idx;
+                while ((idx < len) &&
+                       (isalnum((unsigned char)text[idx]) ||
+                        (text[idx] == '_'))) {
+                        idx++;
+                }
+                if ((idx < len) && (text[idx] == '(')) {
+                        output_cost_call(cost, text + start, idx - start);
+                }
+        }
+}
+
+int output_open(const char *dirname,
+                const char *filename,
+                void *priv,
+                struct opctx **opctx_out)
 {
         struct opctx *opctx;
 
@@ -36,7 +138,8 @@ int output_open(const char *filename, struct opctx **opctx_out)
         }
 
         /* open output file */
-        opctx->outf = genb_fopen_tmp(opctx->filename);
+        opctx->dirname = dirname;
+        opctx->outf = genb_fopen_tmp(dirname, opctx->filename);
         if (opctx->outf == NULL) {
                 free(opctx->filename);
                 free(opctx);
@@ -44,6 +147,8 @@ int output_open(const char *filename, struct opctx **opctx_out)
         }
 
         opctx->lineno = 2;
+        opctx->costing = false;
+        opctx->priv = priv;
         *opctx_out = opctx;
 
         return 0;
@@ -52,17 +157,12 @@ int output_open(const char *filename, struct opctx **opctx_out)
 int output_close(struct opctx *opctx)
 {
         int res;
-        res = genb_fclose_tmp(opctx->outf, opctx->filename);
+        res = genb_fclose_tmp(opctx->outf, opctx->dirname, opctx->filename);
         free(opctx->filename);
         free(opctx);
         return res;
 }
 
-/**
- * buffer to hold formatted output so newlines can be counted
- */
-static char output_buffer[128*1024];
-
 int outputf(struct opctx *opctx, const char *fmt, ...)
 {
         va_list ap;
@@ -70,17 +170,21 @@ int outputf(struct opctx *opctx, const char *fmt, ...)
         int idx;
 
         va_start(ap, fmt);
-        res = vsnprintf(output_buffer, sizeof(output_buffer), fmt, ap);
+        res = vsnprintf(opctx->buffer, sizeof(opctx->buffer), fmt, ap);
         va_end(ap);
 
         /* account for newlines in output */
         for (idx = 0; idx < res; idx++) {
-                if (output_buffer[idx] == '\n') {
+                if (opctx->buffer[idx] == '\n') {
                         opctx->lineno++;
                 }
         }
 
-        fwrite(output_buffer, 1, res, opctx->outf);
+        if (opctx->costing) {
+                output_cost_scan(&opctx->cost, opctx->buffer, res);
+        }
+
+        fwrite(opctx->buffer, 1, res, opctx->outf);
 
         return res;
 }
@@ -89,6 +193,9 @@ int outputc(struct opctx *opctx, int c)
 {
         if (c == '\n') {
                 opctx->lineno++;
+                if (opctx->costing) {
+                        opctx->cost.lines++;
+                }
         }
         fputc(c, opctx->outf);
 
@@ -104,3 +211,25 @@ int output_line(struct opctx *opctx)
         opctx->lineno++;
         return res;
 }
+
+void output_cost_start(struct opctx *opctx)
+{
+        memset(&opctx->cost, 0, sizeof(opctx->cost));
+        opctx->costing = true;
+}
+
+void output_cost_stop(struct opctx *opctx, struct output_cost *cost_out)
+{
+        opctx->costing = false;
+        *cost_out = opctx->cost;
+}
+
+const char *output_dirname(struct opctx *opctx)
+{
+        return opctx->dirname;
+}
+
+void *output_priv(struct opctx *opctx)
+{
+        return opctx->priv;
+}
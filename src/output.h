@@ -11,16 +11,31 @@
 
 struct opctx;
 
+/**
+ * estimated run time cost of generated code
+ */
+struct output_cost {
+        unsigned int lines; /**< lines of code */
+        unsigned int calls; /**< duk API calls */
+        unsigned int lookups; /**< property lookups by string */
+        unsigned int pushes; /**< values pushed on the duk stack */
+        unsigned int allocs; /**< heap allocations */
+        unsigned int strings; /**< dom strings created */
+};
+
 /**
  * open output file
  *
  * opens output file and creates output context
  *
+ * \param dirname The directory to output to, it must remain valid
+ *                until the context is closed.
  * \param filename The filename of the file to output
+ * \param priv The generator context the output belongs to.
  * \param opctx_out The resulting output context
  * \return 0 on success and opctx_out updated else -1
  */
-int output_open(const char *filename, struct opctx **opctx_out);
+int output_open(const char *dirname, const char *filename, void *priv, struct opctx **opctx_out);
 
 /**
  * close output file and free context
@@ -39,4 +54,30 @@ int outputc(struct opctx *opctx, int c);
  */
 int output_line(struct opctx *opctx);
 
+/**
+ * start estimating the cost of the code output
+ *
+ * \param opctx The output context.
+ */
+void output_cost_start(struct opctx *opctx);
+
+/**
+ * stop estimating the cost of the code output
+ *
+ * \param opctx The output context.
+ * \param cost_out Updated with the cost of the code output since
+ *                 output_cost_start.
+ */
+void output_cost_stop(struct opctx *opctx, struct output_cost *cost_out);
+
+/**
+ * get the directory an output context outputs to
+ */
+const char *output_dirname(struct opctx *opctx);
+
+/**
+ * get the generator context an output context was opened with
+ */
+void *output_priv(struct opctx *opctx);
+
 #endif
@@ -0,0 +1,910 @@
+/* binding generation pipeline
+ *
+ * This file is part of nsgenbind.
+ * Licensed under the MIT License,
+ *                http://www.opensource.org/licenses/mit-license.php
+ * Copyright 2012 Vincent Sanders <vince@netsurf-browser.org>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "options.h"
+#include "nsgenbind-ast.h"
+#include "webidl-ast.h"
+#include "ir.h"
+#include "output.h"
+#include "profile.h"
+#include "duk-libdom.h"
+#include "stats.h"
+#include "pipeline.h"
+
+enum bindingtype_e {
+    BINDINGTYPE_UNKNOWN,
+    BINDINGTYPE_JSAPI_LIBDOM,
+    BINDINGTYPE_DUK_LIBDOM,
+};
+
+/**
+ * modification stamp of a source file
+ */
+struct source_stamp {
+        time_t sec; /**< modification time seconds */
+        long nsec; /**< modification time nanoseconds */
+        off_t size; /**< file size */
+};
+
+/**
+ * a file included by a web IDL file
+ */
+struct webidl_include {
+        char *filename; /**< name as given in the directive */
+        struct source_stamp stamp; /**< stamp of the file */
+};
+
+/**
+ * web IDL files used by all the bindings
+ */
+struct webidl_files {
+        int filec; /**< number of distinct files */
+        int allocc; /**< number of files the per file arrays hold */
+        char **filenamev; /**< file names */
+        struct webidl_node **astv; /**< AST of each file once parsed */
+        bool *neededv; /**< file must be parsed */
+        bool *changedv; /**< file changed since the previous run */
+        struct source_stamp *stampv; /**< stamp of each file */
+        int *includecv; /**< number of files each file includes */
+        struct webidl_include **includev; /**< files each file includes */
+};
+
+/**
+ * a binding being generated
+ */
+struct genbind_binding {
+        char *infilename; /**< binding source */
+        char *outdirname; /**< output directory */
+        struct source_stamp stamp; /**< stamp of binding source */
+        bool dirty; /**< binding must be generated */
+        struct genbind_node *genbind; /**< binding AST */
+        enum bindingtype_e type; /**< type of binding */
+        int filec; /**< number of IDL files used */
+        char **filenamev; /**< names of IDL files used */
+        int *fileidxv; /**< index of each IDL file in shared files */
+        char *idlcache; /**< IDL cache file name */
+        char *cachekey; /**< manifest of IDL files for cache */
+        size_t cachekeylen; /**< length of cache manifest */
+        bool cachekeyed; /**< cache key was computed */
+        bool cached; /**< IDL AST was loaded from cache */
+        struct webidl_node *webidl; /**< IDL AST */
+        struct duk_libdom_ctx *dlctx; /**< output generation context */
+};
+
+/**
+ * binding generation pipeline context
+ */
+struct pipeline {
+        struct options *options; /**< options generation uses */
+        int bindingc; /**< number of bindings */
+        struct genbind_binding *bindingv; /**< bindings */
+        struct webidl_files files; /**< IDL files of all bindings */
+};
+
+/**
+ * check if a source file has changed
+ *
+ * A file which cannot be examined has a zero stamp so it is seen as
+ * changed once when it goes missing.
+ *
+ * \param path The file to check.
+ * \param stamp The stamp from the previous check.
+ * \param update Update the stamp.
+ * \return true if the file changed since the stamp was taken.
+ */
+static bool
+source_changed(const char *path, struct source_stamp *stamp, bool update)
+{
+        struct stat st;
+        struct source_stamp cur;
+
+        memset(&cur, 0, sizeof(cur));
+        if (stat(path, &st) == 0) {
+                cur.sec = st.st_mtim.tv_sec;
+                cur.nsec = st.st_mtim.tv_nsec;
+                cur.size = st.st_size;
+        }
+
+        if ((cur.sec == stamp->sec) &&
+            (cur.nsec == stamp->nsec) &&
+            (cur.size == stamp->size)) {
+                return false;
+        }
+
+        if (update) {
+                *stamp = cur;
+        }
+        return true;
+}
+
+static int webidl_file_cb(struct genbind_node *node, void *ctx)
+{
+	struct genbind_binding *binding = ctx;
+	char *filename;
+
+	filename = genbind_node_gettext(node);
+
+        binding->filenamev[binding->filec++] = filename;
+
+	return 0;
+}
+
+/**
+ * gather the IDL files a binding uses into the shared file list
+ */
+static int genbind_get_idl(struct pipeline *pipeline,
+                           struct genbind_binding *binding)
+{
+        struct webidl_files *files = &pipeline->files;
+        struct genbind_node *binding_node;
+        int filec;
+        int idx;
+        int fidx;
+
+        binding_node = genbind_node_find_type(binding->genbind, NULL,
+                                              GENBIND_NODE_TYPE_BINDING);
+
+        filec = genbind_node_enumerate_type(genbind_node_getnode(binding_node),
+                                            GENBIND_NODE_TYPE_WEBIDL);
+
+        free(binding->filenamev);
+        free(binding->fileidxv);
+        binding->filec = 0;
+        binding->filenamev = calloc(filec + 1, sizeof(char *));
+        binding->fileidxv = calloc(filec + 1, sizeof(int));
+        files->filenamev = realloc(files->filenamev,
+                                   (files->filec + filec + 1) * sizeof(char *));
+        if ((binding->filenamev == NULL) ||
+            (binding->fileidxv == NULL) ||
+            (files->filenamev == NULL)) {
+                return -1;
+        }
+
+	/* walk AST and gather any web IDL files required */
+	genbind_node_foreach_type(genbind_node_getnode(binding_node),
+                                  GENBIND_NODE_TYPE_WEBIDL,
+                                  webidl_file_cb,
+                                  binding);
+
+        /* each distinct file is only parsed once for all bindings */
+        for (idx = 0; idx < binding->filec; idx++) {
+                if (pipeline->options->verbose) {
+                        printf("Opening IDL file \"%s\"\n",
+                               binding->filenamev[idx]);
+                }
+                for (fidx = 0; fidx < files->filec; fidx++) {
+                        if (strcmp(files->filenamev[fidx],
+                                   binding->filenamev[idx]) == 0) {
+                                break;
+                        }
+                }
+                if (fidx == files->filec) {
+                        files->filenamev[files->filec++] = binding->filenamev[idx];
+                }
+                binding->fileidxv[idx] = fidx;
+        }
+
+        return 0;
+}
+
+/**
+ * extend the per file arrays to cover newly gathered IDL files
+ */
+static int webidl_files_extend(struct webidl_files *files)
+{
+        struct webidl_node **astv;
+        bool *neededv;
+        bool *changedv;
+        struct source_stamp *stampv;
+        int *includecv;
+        struct webidl_include **includev;
+        int extra;
+
+        if (files->allocc == files->filec) {
+                return 0;
+        }
+
+        astv = realloc(files->astv,
+                       (files->filec + 1) * sizeof(struct webidl_node *));
+        if (astv != NULL) {
+                files->astv = astv;
+        }
+        neededv = realloc(files->neededv, (files->filec + 1) * sizeof(bool));
+        if (neededv != NULL) {
+                files->neededv = neededv;
+        }
+        changedv = realloc(files->changedv, (files->filec + 1) * sizeof(bool));
+        if (changedv != NULL) {
+                files->changedv = changedv;
+        }
+        stampv = realloc(files->stampv,
+                         (files->filec + 1) * sizeof(struct source_stamp));
+        if (stampv != NULL) {
+                files->stampv = stampv;
+        }
+        includecv = realloc(files->includecv, (files->filec + 1) * sizeof(int));
+        if (includecv != NULL) {
+                files->includecv = includecv;
+        }
+        includev = realloc(files->includev,
+                           (files->filec + 1) * sizeof(struct webidl_include *));
+        if (includev != NULL) {
+                files->includev = includev;
+        }
+        if ((astv == NULL) || (neededv == NULL) ||
+            (changedv == NULL) || (stampv == NULL) ||
+            (includecv == NULL) || (includev == NULL)) {
+                return -1;
+        }
+
+        extra = files->filec - files->allocc;
+        memset(astv + files->allocc, 0, extra * sizeof(struct webidl_node *));
+        memset(neededv + files->allocc, 0, extra * sizeof(bool));
+        memset(changedv + files->allocc, 0, extra * sizeof(bool));
+        memset(stampv + files->allocc, 0, extra * sizeof(struct source_stamp));
+        memset(includecv + files->allocc, 0, extra * sizeof(int));
+        memset(includev + files->allocc, 0,
+               extra * sizeof(struct webidl_include *));
+        files->allocc = files->filec;
+
+        return 0;
+}
+
+/**
+ * gather and stamp the files an IDL file includes
+ *
+ * A file whose includes cannot be listed is only watched itself.
+ */
+static void webidl_file_includes(struct webidl_files *files, int fidx)
+{
+        struct webidl_include *includev;
+        char **namev;
+        int namec;
+        int idx;
+
+        for (idx = 0; idx < files->includecv[fidx]; idx++) {
+                free(files->includev[fidx][idx].filename);
+        }
+        free(files->includev[fidx]);
+        files->includev[fidx] = NULL;
+        files->includecv[fidx] = 0;
+
+        if (webidl_includes(files->filenamev[fidx], &namec, &namev) != 0) {
+                return;
+        }
+
+        includev = calloc(namec + 1, sizeof(struct webidl_include));
+        if (includev == NULL) {
+                for (idx = 0; idx < namec; idx++) {
+                        free(namev[idx]);
+                }
+                free(namev);
+                return;
+        }
+        for (idx = 0; idx < namec; idx++) {
+                includev[idx].filename = namev[idx];
+                source_changed(namev[idx], &includev[idx].stamp, true);
+        }
+        free(namev);
+
+        files->includev[fidx] = includev;
+        files->includecv[fidx] = namec;
+}
+
+/**
+ * check if an IDL file or any file it includes changed
+ *
+ * \param files The IDL files.
+ * \param fidx The index of the file to check.
+ * \param update Update the stamps and gather the includes again.
+ * \return true if the file or an include changed since the stamps
+ *         were taken.
+ */
+static bool
+webidl_file_changed(struct webidl_files *files, int fidx, bool update)
+{
+        char *path;
+        bool changed;
+        int idx;
+
+        path = webidl_filepath(files->filenamev[fidx]);
+        if (path == NULL) {
+                return false;
+        }
+        changed = source_changed(path, &files->stampv[fidx], update);
+        free(path);
+
+        for (idx = 0;
+             !changed && (idx < files->includecv[fidx]);
+             idx++) {
+                changed = source_changed(files->includev[fidx][idx].filename,
+                                         &files->includev[fidx][idx].stamp,
+                                         false);
+        }
+
+        /* an edited file may include different files */
+        if (changed && update) {
+                webidl_file_includes(files, fidx);
+        }
+
+        return changed;
+}
+
+/**
+ * parse the IDL files needed by bindings not loaded from cache
+ *
+ * Files already parsed and unchanged since are not parsed again.
+ */
+static int genbind_parse_idl(struct pipeline *pipeline)
+{
+        struct webidl_files *files = &pipeline->files;
+        struct genbind_binding *binding;
+        char **filenamev;
+        struct webidl_node **astv;
+        int *fidxv;
+        int filec = 0;
+        int bidx;
+        int idx;
+        int res;
+
+        filenamev = calloc(files->filec + 1, sizeof(char *));
+        astv = calloc(files->filec + 1, sizeof(struct webidl_node *));
+        fidxv = calloc(files->filec + 1, sizeof(int));
+        if ((filenamev == NULL) || (astv == NULL) || (fidxv == NULL)) {
+                free(filenamev);
+                free(astv);
+                free(fidxv);
+                return -1;
+        }
+
+        memset(files->neededv, 0, files->filec * sizeof(bool));
+        for (bidx = 0; bidx < pipeline->bindingc; bidx++) {
+                binding = &pipeline->bindingv[bidx];
+                if (!binding->dirty || binding->cached) {
+                        continue;
+                }
+                for (idx = 0; idx < binding->filec; idx++) {
+                        files->neededv[binding->fileidxv[idx]] = true;
+                }
+        }
+
+        for (idx = 0; idx < files->filec; idx++) {
+                if (files->neededv[idx] && (files->astv[idx] == NULL)) {
+                        filenamev[filec] = files->filenamev[idx];
+                        fidxv[filec] = idx;
+                        filec++;
+                }
+        }
+
+        /* debug output of the shared parse goes with the first binding */
+        stats_phase_start(STATS_PHASE_IDL_PARSE);
+        res = webidl_parsefiles(pipeline->bindingv[0].outdirname,
+                                filec,
+                                filenamev,
+                                astv);
+        stats_phase_stop(STATS_PHASE_IDL_PARSE);
+        if (res == 0) {
+                for (idx = 0; idx < filec; idx++) {
+                        files->astv[fidxv[idx]] = astv[idx];
+                }
+        }
+
+        free(filenamev);
+        free(astv);
+        free(fidxv);
+
+        return res;
+}
+
+/**
+ * free the IDL AST of a binding
+ */
+static void genbind_free_idl(struct genbind_binding *binding)
+{
+        if (binding->cached) {
+                webidl_cache_free(binding->webidl);
+        } else {
+                webidl_merge_free(binding->webidl);
+        }
+        binding->webidl = NULL;
+        binding->cached = false;
+}
+
+/**
+ * try to load the IDL for a binding from cache
+ *
+ * Any IDL AST the binding had is superseded so is freed.
+ */
+static void genbind_load_idl_cache(struct pipeline *pipeline,
+                                   struct genbind_binding *binding,
+                                   int bidx)
+{
+        struct options *opts = pipeline->options;
+        int namelen;
+        int res;
+
+        genbind_free_idl(binding);
+        binding->cachekeyed = false;
+        free(binding->cachekey);
+        binding->cachekey = NULL;
+
+        if (opts->idlcache == NULL) {
+                return;
+        }
+
+        /* each binding after the first has its own numbered cache */
+        if (binding->idlcache == NULL) {
+                if (bidx == 0) {
+                        binding->idlcache = strdup(opts->idlcache);
+                } else {
+                        namelen = strlen(opts->idlcache) + 16;
+                        binding->idlcache = malloc(namelen);
+                        snprintf(binding->idlcache, namelen, "%s.%d",
+                                 opts->idlcache, bidx);
+                }
+        }
+
+        stats_phase_start(STATS_PHASE_IDL_CACHE);
+        res = webidl_cache_key(binding->filec,
+                               binding->filenamev,
+                               &binding->cachekey,
+                               &binding->cachekeylen);
+        binding->cachekeyed = (res == 0);
+        if (binding->cachekeyed &&
+            (webidl_cache_load(binding->idlcache,
+                               binding->cachekey,
+                               binding->cachekeylen,
+                               &binding->webidl) == 0)) {
+                if (opts->verbose) {
+                        printf("Loaded IDL cache \"%s\"\n",
+                               binding->idlcache);
+                }
+                binding->cached = true;
+        }
+        stats_phase_stop(STATS_PHASE_IDL_CACHE);
+}
+
+/**
+ * build the IDL AST for a binding from the parsed files
+ */
+static int genbind_load_idl(struct genbind_binding *binding, struct webidl_files *files)
+{
+        struct webidl_node **astv;
+        int idx;
+        int res;
+
+        if (binding->cached) {
+                return 0;
+        }
+
+        astv = calloc(binding->filec + 1, sizeof(struct webidl_node *));
+        if (astv == NULL) {
+                return -1;
+        }
+        for (idx = 0; idx < binding->filec; idx++) {
+                astv[idx] = files->astv[binding->fileidxv[idx]];
+        }
+
+        binding->webidl = NULL;
+        stats_phase_start(STATS_PHASE_IDL_MERGE);
+        res = webidl_merge(binding->filec, astv, &binding->webidl);
+        stats_phase_stop(STATS_PHASE_IDL_MERGE);
+        free(astv);
+	if (res != 0) {
+		fprintf(stderr, "Error: failed merging Web IDL\n");
+		return -1;
+	}
+
+        /* implements are implemented as mixins so intercalate them */
+        stats_phase_start(STATS_PHASE_IDL_INTERCALATE);
+        res = webidl_intercalate_implements(binding->webidl);
+        stats_phase_stop(STATS_PHASE_IDL_INTERCALATE);
+	if (res != 0) {
+		fprintf(stderr, "Error: Failed to intercalate implements\n");
+		return -1;
+	}
+
+        /* update the IDL cache, failure only costs a parse next time */
+        if (binding->cachekeyed) {
+                stats_phase_start(STATS_PHASE_IDL_CACHE);
+                webidl_cache_save(binding->idlcache,
+                                  binding->cachekey,
+                                  binding->cachekeylen,
+                                  binding->webidl);
+                stats_phase_stop(STATS_PHASE_IDL_CACHE);
+        }
+
+        return 0;
+}
+
+/**
+ * get the type of binding
+ */
+static enum bindingtype_e genbind_get_type(struct genbind_node *node)
+{
+        struct genbind_node *binding_node;
+        const char *binding_type;
+
+        binding_node = genbind_node_find_type(node,
+                                              NULL,
+                                              GENBIND_NODE_TYPE_BINDING);
+        if (binding_node == NULL) {
+            /* binding entry is missing which is invalid */
+            return BINDINGTYPE_UNKNOWN;
+        }
+
+        binding_type = genbind_node_gettext(
+                genbind_node_find_type(
+                        genbind_node_getnode(binding_node),
+                        NULL,
+                        GENBIND_NODE_TYPE_NAME));
+        if (binding_type == NULL) {
+                fprintf(stderr, "Error: missing binding type\n");
+                return BINDINGTYPE_UNKNOWN;
+        }
+
+        if (strcmp(binding_type, "jsapi_libdom") == 0) {
+                return BINDINGTYPE_JSAPI_LIBDOM;
+        }
+
+        if (strcmp(binding_type, "duk_libdom") == 0) {
+                return BINDINGTYPE_DUK_LIBDOM;
+        }
+
+        fprintf(stderr, "Error: unsupported binding type \"%s\"\n", binding_type);
+
+        return BINDINGTYPE_UNKNOWN;
+}
+
+/**
+ * parse a binding source and gather the IDL files it uses
+ *
+ * The AST of the previous source is superseded so is freed.
+ */
+static int genbind_load_binding(struct pipeline *pipeline,
+                                struct genbind_binding *binding,
+                                int bidx)
+{
+        int res;
+
+        binding->dirty = true;
+
+        /* parse binding */
+        genbind_ast_free(binding->genbind);
+        binding->genbind = NULL;
+        stats_phase_start(STATS_PHASE_BINDING_PARSE);
+        res = genbind_parsefile(binding->infilename,
+                                binding->outdirname,
+                                &binding->genbind);
+        stats_phase_stop(STATS_PHASE_BINDING_PARSE);
+        if (res != 0) {
+                fprintf(stderr, "Error: parse failed with code %d\n", res);
+                genbind_ast_free(binding->genbind);
+                binding->genbind = NULL;
+                return res;
+        }
+
+        /* dump the binding AST */
+        genbind_dump_ast(binding->outdirname, binding->genbind);
+
+        /* get type of binding */
+        binding->type = genbind_get_type(binding->genbind);
+        if (binding->type == BINDINGTYPE_UNKNOWN) {
+                genbind_ast_free(binding->genbind);
+                binding->genbind = NULL;
+                return 3;
+        }
+
+        /* gather the IDL files specified in the binding */
+        res = genbind_get_idl(pipeline, binding);
+        if (res != 0) {
+                genbind_ast_free(binding->genbind);
+                binding->genbind = NULL;
+                return 4;
+        }
+
+        genbind_load_idl_cache(pipeline, binding, bidx);
+
+        return 0;
+}
+
+/**
+ * generate the output of a binding
+ */
+static int genbind_generate(struct genbind_binding *binding,
+                            struct webidl_files *files)
+{
+        struct ir *ir = NULL;
+        int res;
+
+        /* load the IDL files specified in the binding */
+        res = genbind_load_idl(binding, files);
+        if (res != 0) {
+                return 4;
+        }
+
+        /* debug dump of web idl AST */
+        webidl_dump_ast(binding->outdirname, binding->webidl);
+
+        /* generate intermediate representation */
+        stats_phase_start(STATS_PHASE_IR);
+        res = ir_new(binding->genbind, binding->webidl, &ir);
+        stats_phase_stop(STATS_PHASE_IR);
+        if (res != 0) {
+                return 5;
+        }
+
+        /* dump the intermediate representation */
+        ir_dump(binding->outdirname, ir);
+        ir_dumpdot(binding->outdirname, ir);
+
+        /* generate binding */
+        switch (binding->type) {
+        case BINDINGTYPE_DUK_LIBDOM:
+                if ((binding->dlctx == NULL) &&
+                    (duk_libdom_ctx_new(binding->outdirname,
+                                        &binding->dlctx) != 0)) {
+                        res = -1;
+                        break;
+                }
+                stats_phase_start(STATS_PHASE_OUTPUT);
+                res = duk_libdom_output(binding->dlctx, ir);
+                stats_phase_stop(STATS_PHASE_OUTPUT);
+                break;
+
+        default:
+                fprintf(stderr, "Unable to generate binding of this type\n");
+                res = 7;
+        }
+
+        ir_free(ir);
+
+        return res;
+}
+
+/**
+ * check if any source of a pipeline changed since it last ran
+ */
+static bool pipeline_modified(struct pipeline *pipeline)
+{
+        struct webidl_files *files = &pipeline->files;
+        int bidx;
+        int fidx;
+
+        for (bidx = 0; bidx < pipeline->bindingc; bidx++) {
+                if (source_changed(pipeline->bindingv[bidx].infilename,
+                                   &pipeline->bindingv[bidx].stamp,
+                                   false)) {
+                        return true;
+                }
+        }
+
+        for (fidx = 0; fidx < files->allocc; fidx++) {
+                if (webidl_file_changed(files, fidx, false)) {
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+/* exported interface documented in pipeline.h */
+int pipeline_new(struct options *opts, struct pipeline **pipeline_out)
+{
+        struct pipeline *pipeline;
+
+        pipeline = calloc(1, sizeof(struct pipeline));
+        if (pipeline == NULL) {
+                return -1;
+        }
+        pipeline->options = opts;
+
+        *pipeline_out = pipeline;
+
+        return 0;
+}
+
+/* exported interface documented in pipeline.h */
+int pipeline_add_binding(struct pipeline *pipeline,
+                         const char *infilename,
+                         const char *outdirname)
+{
+        struct genbind_binding *bindingv;
+        struct genbind_binding *binding;
+
+        bindingv = realloc(pipeline->bindingv,
+                           (pipeline->bindingc + 1) *
+                           sizeof(struct genbind_binding));
+        if (bindingv == NULL) {
+                return -1;
+        }
+        pipeline->bindingv = bindingv;
+
+        binding = &bindingv[pipeline->bindingc];
+        memset(binding, 0, sizeof(struct genbind_binding));
+        binding->infilename = strdup(infilename);
+        binding->outdirname = strdup(outdirname);
+        if ((binding->infilename == NULL) || (binding->outdirname == NULL)) {
+                free(binding->infilename);
+                free(binding->outdirname);
+                return -1;
+        }
+        pipeline->bindingc++;
+
+        return 0;
+}
+
+/**
+ * forget the stamps of every source of a pipeline
+ *
+ * The stamps are taken as the sources are examined, before they are
+ * parsed, so after a failed run they are cleared and every source is
+ * seen as changed and processed again by the next run.
+ */
+static void pipeline_forget_stamps(struct pipeline *pipeline)
+{
+        struct webidl_files *files = &pipeline->files;
+        int bidx;
+        int fidx;
+
+        for (bidx = 0; bidx < pipeline->bindingc; bidx++) {
+                memset(&pipeline->bindingv[bidx].stamp,
+                       0,
+                       sizeof(struct source_stamp));
+        }
+
+        for (fidx = 0; fidx < files->allocc; fidx++) {
+                memset(&files->stampv[fidx], 0, sizeof(struct source_stamp));
+        }
+}
+
+/**
+ * parse the changed sources of a pipeline and generate its bindings
+ */
+static int pipeline_generate(struct pipeline *pipeline)
+{
+        struct webidl_files *files = &pipeline->files;
+        struct genbind_binding *binding;
+        int bidx;
+        int fidx;
+        int idx;
+        int res;
+
+        if (pipeline->bindingc == 0) {
+                return 0;
+        }
+
+        /* parse the bindings whose source changed */
+        for (bidx = 0; bidx < pipeline->bindingc; bidx++) {
+                binding = &pipeline->bindingv[bidx];
+                if (!source_changed(binding->infilename,
+                                    &binding->stamp,
+                                    true) &&
+                    (binding->genbind != NULL)) {
+                        continue;
+                }
+
+                res = genbind_load_binding(pipeline, binding, bidx);
+                if (res != 0) {
+                        return res;
+                }
+        }
+
+        if (webidl_files_extend(files) != 0) {
+                return 4;
+        }
+
+        /* IDL files which changed, or whose includes did, are parsed again */
+        for (fidx = 0; fidx < files->filec; fidx++) {
+                files->changedv[fidx] = webidl_file_changed(files, fidx, true);
+                if (files->changedv[fidx]) {
+                        webidl_ast_free(files->astv[fidx]);
+                        files->astv[fidx] = NULL;
+                }
+        }
+
+        /* bindings using changed IDL files must be generated again */
+        for (bidx = 0; bidx < pipeline->bindingc; bidx++) {
+                binding = &pipeline->bindingv[bidx];
+                if (binding->dirty) {
+                        continue;
+                }
+                for (idx = 0; idx < binding->filec; idx++) {
+                        if (files->changedv[binding->fileidxv[idx]]) {
+                                break;
+                        }
+                }
+                if (idx == binding->filec) {
+                        continue;
+                }
+                binding->dirty = true;
+                genbind_load_idl_cache(pipeline, binding, bidx);
+        }
+
+        /* parse every IDL file needed once for all bindings */
+        res = genbind_parse_idl(pipeline);
+	if (res != 0) {
+		fprintf(stderr, "Error: failed reading Web IDL\n");
+		return 4;
+	}
+
+        for (bidx = 0; bidx < pipeline->bindingc; bidx++) {
+                binding = &pipeline->bindingv[bidx];
+                if (!binding->dirty) {
+                        continue;
+                }
+
+                res = genbind_generate(binding, files);
+                if (res != 0) {
+                        return res;
+                }
+                binding->dirty = false;
+        }
+
+        return 0;
+}
+
+/* exported interface documented in pipeline.h */
+int pipeline_run(struct pipeline *pipeline)
+{
+        int res;
+
+        res = pipeline_generate(pipeline);
+        if (res != 0) {
+                pipeline_forget_stamps(pipeline);
+        }
+
+        return res;
+}
+
+/* exported interface documented in pipeline.h */
+int pipeline_watch(struct pipeline *pipeline, unsigned int interval)
+{
+        struct timespec delay;
+        int res;
+
+        delay.tv_sec = interval / 1000;
+        delay.tv_nsec = (interval % 1000) * 1000000L;
+
+        while (true) {
+                if ((nanosleep(&delay, NULL) != 0) && (errno != EINTR)) {
+                        return 1;
+                }
+
+                if (!pipeline_modified(pipeline)) {
+                        continue;
+                }
+
+                if (pipeline->options->verbose) {
+                        printf("Sources changed, regenerating\n");
+                }
+
+                /* each report covers only the run it follows */
+                stats_reset();
+                res = pipeline_run(pipeline);
+                if (res != 0) {
+                        fprintf(stderr,
+                                "Error: generation failed with code %d\n",
+                                res);
+                        continue;
+                }
+
+                stats_report(stdout);
+                fflush(stdout);
+        }
+}
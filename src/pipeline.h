@@ -0,0 +1,72 @@
+/* binding generation pipeline
+ *
+ * This file is part of nsgenbind.
+ * Licensed under the MIT License,
+ *                http://www.opensource.org/licenses/mit-license.php
+ * Copyright 2012 Vincent Sanders <vince@netsurf-browser.org>
+ */
+
+#ifndef nsgenbind_pipeline_h
+#define nsgenbind_pipeline_h
+
+struct options;
+
+/**
+ * binding generation pipeline context
+ *
+ * A pipeline holds the parsed binding and IDL files of a set of
+ * bindings so they may be regenerated when their sources change
+ * without parsing unchanged files again.
+ */
+struct pipeline;
+
+/**
+ * create a pipeline
+ *
+ * \param opts The options the pipeline runs with, they are only read
+ *             so may be shared by several pipelines. The output
+ *             directory and generation state of each binding are
+ *             held by the pipeline.
+ * \param pipeline_out Updated with the new pipeline.
+ * \return 0 on success else -1 on allocation error.
+ */
+int pipeline_new(struct options *opts, struct pipeline **pipeline_out);
+
+/**
+ * add a binding to a pipeline
+ *
+ * \param pipeline The pipeline to add to.
+ * \param infilename The binding source file.
+ * \param outdirname The directory output is placed in.
+ * \return 0 on success else -1 on allocation error.
+ */
+int pipeline_add_binding(struct pipeline *pipeline,
+                         const char *infilename,
+                         const char *outdirname);
+
+/**
+ * generate the bindings of a pipeline
+ *
+ * The first run parses every binding and IDL file and generates all
+ * the bindings. Subsequent runs only parse files which have been
+ * modified and only regenerate the bindings using them. A failed run
+ * forgets which files it examined so the next run processes them all
+ * again.
+ *
+ * \param pipeline The pipeline to run.
+ * \return 0 on success else the error code of the failing stage.
+ */
+int pipeline_run(struct pipeline *pipeline);
+
+/**
+ * run a pipeline whenever its sources are modified
+ *
+ * Does not return unless generation cannot continue.
+ *
+ * \param pipeline The pipeline to run.
+ * \param interval The number of milliseconds between checks.
+ * \return error code
+ */
+int pipeline_watch(struct pipeline *pipeline, unsigned int interval);
+
+#endif
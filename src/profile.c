@@ -0,0 +1,277 @@
+/* runtime call profile
+ *
+ * This file is part of nsgenbind.
+ * Licensed under the MIT License,
+ *                http://www.opensource.org/licenses/mit-license.php
+ * Copyright 2012 Vincent Sanders <vince@netsurf-browser.org>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+
+#include "profile.h"
+
+/** proportion of all calls the hot functions account for */
+#define PROFILE_HOT_PERCENT 90
+
+/** call count of a function */
+struct profile_count {
+        char *name; /**< interface::member or interface */
+        char *kind; /**< kind of function or NULL for any */
+        unsigned long long calls; /**< number of calls */
+        bool hot; /**< function is hot */
+};
+
+struct profile {
+        struct profile_count *countv; /**< counts sorted by name */
+        int countc; /**< number of counts */
+};
+
+static bool is_count(const char *token)
+{
+        if (*token == 0) {
+                return false;
+        }
+        while (*token != 0) {
+                if (!isdigit((unsigned char)*token)) {
+                        return false;
+                }
+                token++;
+        }
+        return true;
+}
+
+static int count_name_cmp(const void *a, const void *b)
+{
+        const struct profile_count *ca = a;
+        const struct profile_count *cb = b;
+
+        return strcmp(ca->name, cb->name);
+}
+
+static int count_calls_cmp(const void *a, const void *b)
+{
+        const struct profile_count *ca = *(const struct profile_count * const *)a;
+        const struct profile_count *cb = *(const struct profile_count * const *)b;
+
+        if (ca->calls == cb->calls) {
+                return 0;
+        }
+        return (ca->calls < cb->calls) ? 1 : -1;
+}
+
+/**
+ * parse a profile line into a count
+ *
+ * \return 1 if a count was added, 0 if the line has no count or -1 on error
+ */
+static int
+profile_parse_line(struct profile *profile, char *line)
+{
+        struct profile_count *newv;
+        char *token;
+        char *name = NULL;
+        char *kind = NULL;
+        bool counted = false;
+        unsigned long long calls = 0;
+
+        for (token = strtok(line, ", \t\r\n");
+             token != NULL;
+             token = strtok(NULL, ", \t\r\n")) {
+                if (is_count(token)) {
+                        /* only the first number is the call count */
+                        if (!counted) {
+                                calls = strtoull(token, NULL, 10);
+                                counted = true;
+                        }
+                } else if (name == NULL) {
+                        name = token;
+                } else if (kind == NULL) {
+                        kind = token;
+                }
+        }
+
+        if ((name == NULL) || (!counted)) {
+                return 0;
+        }
+
+        newv = realloc(profile->countv,
+                       (profile->countc + 1) * sizeof(struct profile_count));
+        if (newv == NULL) {
+                return -1;
+        }
+        profile->countv = newv;
+
+        newv[profile->countc].name = strdup(name);
+        newv[profile->countc].kind = (kind != NULL) ? strdup(kind) : NULL;
+        newv[profile->countc].calls = calls;
+        newv[profile->countc].hot = false;
+        profile->countc++;
+
+        return 1;
+}
+
+/**
+ * mark the most called functions which account for most calls as hot
+ */
+static int profile_mark_hot(struct profile *profile)
+{
+        struct profile_count **sortedv;
+        unsigned long long total = 0;
+        unsigned long long hot = 0;
+        int idx;
+
+        if (profile->countc == 0) {
+                return 0;
+        }
+
+        sortedv = malloc(profile->countc * sizeof(struct profile_count *));
+        if (sortedv == NULL) {
+                return -1;
+        }
+
+        for (idx = 0; idx < profile->countc; idx++) {
+                sortedv[idx] = &profile->countv[idx];
+                total += profile->countv[idx].calls;
+        }
+
+        qsort(sortedv, profile->countc, sizeof(sortedv[0]), count_calls_cmp);
+
+        for (idx = 0; idx < profile->countc; idx++) {
+                if ((sortedv[idx]->calls == 0) ||
+                    ((hot * 100) >= (total * PROFILE_HOT_PERCENT))) {
+                        break;
+                }
+                sortedv[idx]->hot = true;
+                hot += sortedv[idx]->calls;
+        }
+
+        free(sortedv);
+
+        return 0;
+}
+
+/* exported interface documented in profile.h */
+int profile_load(const char *filename, struct profile **profile_out)
+{
+        struct profile *profile;
+        FILE *infile;
+        char line[1024];
+        int res = 0;
+
+        infile = fopen(filename, "r");
+        if (infile == NULL) {
+                fprintf(stderr, "Error opening profile %s: %s\n",
+                        filename, strerror(errno));
+                return -1;
+        }
+
+        profile = calloc(1, sizeof(struct profile));
+        if (profile == NULL) {
+                fclose(infile);
+                return -1;
+        }
+
+        while (fgets(line, sizeof(line), infile) != NULL) {
+                if (line[0] == '#') {
+                        continue;
+                }
+                if (profile_parse_line(profile, line) < 0) {
+                        res = -1;
+                        break;
+                }
+        }
+        fclose(infile);
+
+        if (res == 0) {
+                res = profile_mark_hot(profile);
+        }
+
+        if (res != 0) {
+                fprintf(stderr, "Error reading profile %s\n", filename);
+                profile_free(profile);
+                return -1;
+        }
+
+        qsort(profile->countv,
+              profile->countc,
+              sizeof(struct profile_count),
+              count_name_cmp);
+
+        *profile_out = profile;
+
+        return 0;
+}
+
+/* exported interface documented in profile.h */
+void profile_free(struct profile *profile)
+{
+        int idx;
+
+        if (profile == NULL) {
+                return;
+        }
+
+        for (idx = 0; idx < profile->countc; idx++) {
+                free(profile->countv[idx].name);
+                free(profile->countv[idx].kind);
+        }
+        free(profile->countv);
+        free(profile);
+}
+
+/* exported interface documented in profile.h */
+enum profile_temperature
+profile_temperature(struct profile *profile,
+                    const char *interface,
+                    const char *kind,
+                    const char *member)
+{
+        struct profile_count key;
+        struct profile_count *count;
+        enum profile_temperature temperature = PROFILE_COLD;
+        char name[256];
+        int idx;
+
+        if (member != NULL) {
+                snprintf(name, sizeof(name), "%s::%s", interface, member);
+        } else {
+                snprintf(name, sizeof(name), "%s", interface);
+        }
+        key.name = name;
+
+        count = bsearch(&key,
+                        profile->countv,
+                        profile->countc,
+                        sizeof(struct profile_count),
+                        count_name_cmp);
+        if (count == NULL) {
+                return PROFILE_COLD;
+        }
+
+        /* several counts may share a name, one for each kind */
+        idx = count - profile->countv;
+        while ((idx > 0) && (strcmp(profile->countv[idx - 1].name, name) == 0)) {
+                idx--;
+        }
+
+        for (; (idx < profile->countc) &&
+                     (strcmp(profile->countv[idx].name, name) == 0); idx++) {
+                count = &profile->countv[idx];
+                if ((count->kind != NULL) && (strcmp(count->kind, kind) != 0)) {
+                        continue;
+                }
+                if (count->hot) {
+                        return PROFILE_HOT;
+                }
+                if (count->calls > 0) {
+                        temperature = PROFILE_WARM;
+                }
+        }
+
+        return temperature;
+}
@@ -0,0 +1,60 @@
+/* runtime call profile
+ *
+ * This file is part of nsgenbind.
+ * Licensed under the MIT License,
+ *                http://www.opensource.org/licenses/mit-license.php
+ * Copyright 2012 Vincent Sanders <vince@netsurf-browser.org>
+ */
+
+#ifndef nsgenbind_profile_h
+#define nsgenbind_profile_h
+
+/** how often a generated function is called */
+enum profile_temperature {
+        PROFILE_HOT, /**< among the most called functions */
+        PROFILE_WARM, /**< called but not often */
+        PROFILE_COLD, /**< never called */
+};
+
+struct profile;
+
+/**
+ * load a runtime call profile
+ *
+ * Each line of the profile names a function as interface::member,
+ * optionally followed by its kind (method, getter, setter, constructor
+ * or finaliser), and gives its call count. Fields may be separated by
+ * commas or spaces so both CSV files and the output of the generated
+ * dukky_profile_dump() are accepted. Lines without a count are
+ * ignored.
+ *
+ * The hot functions are the most called which together account for
+ * 90% of all calls.
+ *
+ * \param filename The profile file.
+ * \param profile_out Updated with the loaded profile.
+ * \return 0 on success else -1 and an error message printed.
+ */
+int profile_load(const char *filename, struct profile **profile_out);
+
+/**
+ * free a runtime call profile
+ */
+void profile_free(struct profile *profile);
+
+/**
+ * get the temperature of a generated function
+ *
+ * \param profile The profile.
+ * \param interface The interface name.
+ * \param kind The kind of function.
+ * \param member The member name or NULL.
+ * \return The temperature, functions not in the profile are cold.
+ */
+enum profile_temperature
+profile_temperature(struct profile *profile,
+                    const char *interface,
+                    const char *kind,
+                    const char *member);
+
+#endif
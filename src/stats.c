@@ -0,0 +1,300 @@
+/* generation statistics
+ *
+ * This file is part of nsgenbind.
+ * Licensed under the MIT License,
+ *                http://www.opensource.org/licenses/mit-license.php
+ * Copyright 2012 Vincent Sanders <vince@netsurf-browser.org>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/resource.h>
+
+#include "options.h"
+#include "nsgenbind-ast.h"
+#include "webidl-ast.h"
+#include "stats.h"
+
+/** number of node types counted for each AST */
+#define STATS_NODE_TYPES 32
+
+/** timing of a phase */
+struct stats_timing {
+        unsigned int calls; /**< number of times phase ran */
+        struct timespec wall_start; /**< wall clock at start */
+        struct timespec cpu_start; /**< process cpu time at start */
+        double wall; /**< total wall clock seconds */
+        double cpu; /**< total process cpu seconds */
+};
+
+/** node counts of an AST */
+struct stats_nodes {
+        unsigned long typev[STATS_NODE_TYPES]; /**< nodes of each type */
+        unsigned long count; /**< total nodes */
+        unsigned long bytes; /**< total bytes allocated */
+};
+
+static struct stats {
+        pthread_mutex_t lock; /**< serialises counting from parse threads */
+        struct stats_timing phasev[STATS_PHASE_COUNT];
+        struct stats_nodes astv[STATS_AST_COUNT];
+        unsigned long textc; /**< interned strings */
+        unsigned long textbytes; /**< interned string bytes */
+        unsigned long filec; /**< generated files */
+        unsigned long writtenc; /**< files written */
+        unsigned long unchangedc; /**< files unchanged and not written */
+        unsigned long filebytes; /**< bytes generated */
+} stats = {
+        .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static const char *phase_names[STATS_PHASE_COUNT] = {
+        "binding_parse",
+        "idl_cache",
+        "idl_parse",
+        "idl_merge",
+        "idl_intercalate",
+        "ir",
+        "output",
+        "output_interfaces",
+        "output_class_headers",
+        "output_private",
+        "output_prototype",
+        "output_common_header",
+        "output_binding_header",
+        "output_binding_source",
+        "output_shards",
+        "output_makefile",
+};
+
+static const char *ast_names[STATS_AST_COUNT] = {
+        "genbind",
+        "webidl",
+};
+
+static double timespec_diff(struct timespec *end, struct timespec *start)
+{
+        return (double)(end->tv_sec - start->tv_sec) +
+                ((double)(end->tv_nsec - start->tv_nsec) / 1000000000.0);
+}
+
+static const char *node_type_name(enum stats_ast ast, int type)
+{
+        if (ast == STATS_AST_GENBIND) {
+                return genbind_node_type_to_str(type);
+        }
+        return webidl_node_type_to_str(type);
+}
+
+/* exported interface documented in stats.h */
+void stats_phase_start(enum stats_phase phase)
+{
+        struct stats_timing *timing = &stats.phasev[phase];
+
+        if (options->stats == STATS_OFF) {
+                return;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &timing->wall_start);
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &timing->cpu_start);
+}
+
+/* exported interface documented in stats.h */
+void stats_phase_stop(enum stats_phase phase)
+{
+        struct stats_timing *timing = &stats.phasev[phase];
+        struct timespec wall;
+        struct timespec cpu;
+
+        if (options->stats == STATS_OFF) {
+                return;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &wall);
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu);
+
+        timing->calls++;
+        timing->wall += timespec_diff(&wall, &timing->wall_start);
+        timing->cpu += timespec_diff(&cpu, &timing->cpu_start);
+}
+
+/* exported interface documented in stats.h */
+void stats_node(enum stats_ast ast, int type, unsigned int count, size_t size)
+{
+        struct stats_nodes *nodes = &stats.astv[ast];
+
+        if (options->stats == STATS_OFF) {
+                return;
+        }
+
+        pthread_mutex_lock(&stats.lock);
+        if ((type >= 0) && (type < STATS_NODE_TYPES)) {
+                nodes->typev[type] += count;
+        }
+        nodes->count += count;
+        nodes->bytes += count * size;
+        pthread_mutex_unlock(&stats.lock);
+}
+
+/* exported interface documented in stats.h */
+void stats_text(size_t size)
+{
+        if (options->stats == STATS_OFF) {
+                return;
+        }
+
+        pthread_mutex_lock(&stats.lock);
+        stats.textc++;
+        stats.textbytes += size;
+        pthread_mutex_unlock(&stats.lock);
+}
+
+/* exported interface documented in stats.h */
+void stats_file(size_t size, bool written)
+{
+        if (options->stats == STATS_OFF) {
+                return;
+        }
+
+        stats.filec++;
+        stats.filebytes += size;
+        if (written) {
+                stats.writtenc++;
+        } else {
+                stats.unchangedc++;
+        }
+}
+
+/* exported interface documented in stats.h */
+void stats_reset(void)
+{
+        pthread_mutex_lock(&stats.lock);
+        memset(stats.phasev, 0, sizeof(stats.phasev));
+        memset(stats.astv, 0, sizeof(stats.astv));
+        stats.textc = 0;
+        stats.textbytes = 0;
+        stats.filec = 0;
+        stats.writtenc = 0;
+        stats.unchangedc = 0;
+        stats.filebytes = 0;
+        pthread_mutex_unlock(&stats.lock);
+}
+
+static void stats_report_text(FILE *outf, long maxrss)
+{
+        struct stats_timing *timing;
+        struct stats_nodes *nodes;
+        int phase;
+        int ast;
+        int type;
+
+        fprintf(outf, "%-24s %8s %12s %12s\n",
+                "phase", "calls", "wall (s)", "cpu (s)");
+        for (phase = 0; phase < STATS_PHASE_COUNT; phase++) {
+                timing = &stats.phasev[phase];
+                fprintf(outf, "%-24s %8u %12.6f %12.6f\n",
+                        phase_names[phase],
+                        timing->calls,
+                        timing->wall,
+                        timing->cpu);
+        }
+
+        for (ast = 0; ast < STATS_AST_COUNT; ast++) {
+                nodes = &stats.astv[ast];
+                fprintf(outf, "\n%s nodes: %lu (%lu bytes)\n",
+                        ast_names[ast], nodes->count, nodes->bytes);
+                for (type = 0; type < STATS_NODE_TYPES; type++) {
+                        if (nodes->typev[type] == 0) {
+                                continue;
+                        }
+                        fprintf(outf, "  %-22s %10lu\n",
+                                node_type_name(ast, type),
+                                nodes->typev[type]);
+                }
+        }
+
+        fprintf(outf, "\ninterned text: %lu (%lu bytes)\n",
+                stats.textc, stats.textbytes);
+        fprintf(outf, "output files: %lu written: %lu unchanged: %lu (%lu bytes)\n",
+                stats.filec, stats.writtenc, stats.unchangedc, stats.filebytes);
+        fprintf(outf, "peak resident: %ld kB\n", maxrss);
+}
+
+static void stats_report_json(FILE *outf, long maxrss)
+{
+        struct stats_timing *timing;
+        struct stats_nodes *nodes;
+        const char *sep;
+        int phase;
+        int ast;
+        int type;
+
+        fprintf(outf, "{\n  \"phases\": {\n");
+        for (phase = 0; phase < STATS_PHASE_COUNT; phase++) {
+                timing = &stats.phasev[phase];
+                fprintf(outf,
+                        "    \"%s\": { \"calls\": %u, \"wall\": %.6f, \"cpu\": %.6f }%s\n",
+                        phase_names[phase],
+                        timing->calls,
+                        timing->wall,
+                        timing->cpu,
+                        (phase + 1 < STATS_PHASE_COUNT) ? "," : "");
+        }
+        fprintf(outf, "  },\n  \"nodes\": {\n");
+        for (ast = 0; ast < STATS_AST_COUNT; ast++) {
+                nodes = &stats.astv[ast];
+                fprintf(outf,
+                        "    \"%s\": { \"count\": %lu, \"bytes\": %lu, \"types\": {",
+                        ast_names[ast], nodes->count, nodes->bytes);
+                sep = " ";
+                for (type = 0; type < STATS_NODE_TYPES; type++) {
+                        if (nodes->typev[type] == 0) {
+                                continue;
+                        }
+                        fprintf(outf, "%s\"%s\": %lu",
+                                sep,
+                                node_type_name(ast, type),
+                                nodes->typev[type]);
+                        sep = ", ";
+                }
+                fprintf(outf, " } }%s\n",
+                        (ast + 1 < STATS_AST_COUNT) ? "," : "");
+        }
+        fprintf(outf, "  },\n");
+        fprintf(outf, "  \"text\": { \"count\": %lu, \"bytes\": %lu },\n",
+                stats.textc, stats.textbytes);
+        fprintf(outf,
+                "  \"output\": { \"files\": %lu, \"written\": %lu, \"unchanged\": %lu, \"bytes\": %lu },\n",
+                stats.filec, stats.writtenc, stats.unchangedc, stats.filebytes);
+        fprintf(outf, "  \"maxrss\": %ld\n}\n", maxrss);
+}
+
+/* exported interface documented in stats.h */
+int stats_report(FILE *outf)
+{
+        struct rusage usage;
+        long maxrss = 0;
+
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+                maxrss = usage.ru_maxrss;
+        }
+
+        switch (options->stats) {
+        case STATS_TEXT:
+                stats_report_text(outf, maxrss);
+                break;
+
+        case STATS_JSON:
+                stats_report_json(outf, maxrss);
+                break;
+
+        default:
+                return 0;
+        }
+
+        return ferror(outf) ? -1 : 0;
+}
@@ -0,0 +1,96 @@
+/* generation statistics
+ *
+ * This file is part of nsgenbind.
+ * Licensed under the MIT License,
+ *                http://www.opensource.org/licenses/mit-license.php
+ * Copyright 2012 Vincent Sanders <vince@netsurf-browser.org>
+ */
+
+#ifndef nsgenbind_stats_h
+#define nsgenbind_stats_h
+
+#include <stdio.h>
+#include <stdbool.h>
+
+/** timed phases of generation */
+enum stats_phase {
+        STATS_PHASE_BINDING_PARSE, /**< parsing binding files */
+        STATS_PHASE_IDL_CACHE, /**< keying, loading and saving IDL cache */
+        STATS_PHASE_IDL_PARSE, /**< parsing IDL files */
+        STATS_PHASE_IDL_MERGE, /**< merging IDL file ASTs */
+        STATS_PHASE_IDL_INTERCALATE, /**< intercalating implements */
+        STATS_PHASE_IR, /**< building intermediate representation */
+        STATS_PHASE_OUTPUT, /**< generating output */
+        STATS_PHASE_OUTPUT_INTERFACES, /**< interface and dictionary sources */
+        STATS_PHASE_OUTPUT_CLASS_HEADERS, /**< per class headers */
+        STATS_PHASE_OUTPUT_PRIVATE, /**< private header */
+        STATS_PHASE_OUTPUT_PROTOTYPE, /**< prototype header */
+        STATS_PHASE_OUTPUT_COMMON_HEADER, /**< common header */
+        STATS_PHASE_OUTPUT_BINDING_HEADER, /**< binding header */
+        STATS_PHASE_OUTPUT_BINDING_SOURCE, /**< binding source */
+        STATS_PHASE_OUTPUT_SHARDS, /**< unity build shards */
+        STATS_PHASE_OUTPUT_MAKEFILE, /**< makefile fragment */
+        STATS_PHASE_COUNT,
+};
+
+/** abstract syntax trees nodes are counted for */
+enum stats_ast {
+        STATS_AST_GENBIND, /**< binding file AST */
+        STATS_AST_WEBIDL, /**< Web IDL AST */
+        STATS_AST_COUNT,
+};
+
+/**
+ * start timing a phase
+ */
+void stats_phase_start(enum stats_phase phase);
+
+/**
+ * stop timing a phase adding the time since it started to its total
+ */
+void stats_phase_stop(enum stats_phase phase);
+
+/**
+ * count the allocation of AST nodes
+ *
+ * Safe to call from concurrent parsers.
+ *
+ * \param ast The AST the nodes belong to.
+ * \param type The node type.
+ * \param count The number of nodes.
+ * \param size The size of each node.
+ */
+void stats_node(enum stats_ast ast, int type, unsigned int count, size_t size);
+
+/**
+ * count the allocation of interned text
+ *
+ * \param size The size of the allocation.
+ */
+void stats_text(size_t size);
+
+/**
+ * count a generated output file
+ *
+ * \param size The length of the generated content.
+ * \param written true if the file was written or false if it was
+ *                unchanged and left alone.
+ */
+void stats_file(size_t size, bool written);
+
+/**
+ * discard the statistics gathered so far
+ *
+ * Used so the report of each regeneration only covers that run.
+ */
+void stats_reset(void);
+
+/**
+ * report the statistics gathered in the selected format
+ *
+ * \param outf The stream to report to.
+ * \return 0 on success else -1
+ */
+int stats_report(FILE *outf);
+
+#endif
@@ -11,39 +11,44 @@
 #include <stdbool.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include <unistd.h>
+#include <pthread.h>
 
 #include "options.h"
 #include "utils.h"
+#include "stats.h"
 
 /* exported function documented in utils.h */
-char *genb_fpath(const char *fname)
+char *genb_fpath(const char *dirname, const char *fname)
 {
         char *fpath;
         int fpathl;
 
-        fpathl = strlen(options->outdirname) + strlen(fname) + 2;
+        fpathl = strlen(dirname) + strlen(fname) + 2;
         fpath = malloc(fpathl);
-        snprintf(fpath, fpathl, "%s/%s", options->outdirname, fname);
+        snprintf(fpath, fpathl, "%s/%s", dirname, fname);
 
         return fpath;
 }
 
-static char *genb_fpath_tmp(const char *fname)
+static char *genb_fpath_tmp(const char *dirname, const char *fname)
 {
         char *fpath;
         int fpathl;
 
-        fpathl = strlen(options->outdirname) + strlen(fname) + 3;
+        fpathl = strlen(dirname) + strlen(fname) + 3;
         fpath = malloc(fpathl);
-        snprintf(fpath, fpathl, "%s/%s.%d", options->outdirname, fname, getpid());
+        snprintf(fpath, fpathl, "%s/%s.%d", dirname, fname, getpid());
 
         return fpath;
 }
 
 /* exported function documented in utils.h */
-FILE *genb_fopen(const char *fname, const char *mode)
+FILE *genb_fopen(const char *dirname, const char *fname, const char *mode)
 {
         char *fpath;
         FILE *filef;
@@ -51,7 +56,7 @@ FILE *genb_fopen(const char *fname, const char *mode)
         if (options->dryrun) {
                 fpath = strdup("/dev/null");
         } else {
-                fpath = genb_fpath(fname);
+                fpath = genb_fpath(dirname, fname);
         }
 
         filef = fopen(fpath, mode);
@@ -67,7 +72,7 @@ FILE *genb_fopen(const char *fname, const char *mode)
 }
 
 /* exported function documented in utils.h */
-FILE *genb_fopen_tmp(const char *fname)
+FILE *genb_fopen_tmp(const char *dirname, const char *fname)
 {
         char *fpath;
         FILE *filef;
@@ -75,7 +80,7 @@ FILE *genb_fopen_tmp(const char *fname)
         if (options->dryrun) {
                 fpath = strdup("/dev/null");
         } else {
-                fpath = genb_fpath_tmp(fname);
+                fpath = genb_fpath_tmp(dirname, fname);
         }
 
         filef = fopen(fpath, "w+");
@@ -90,7 +95,7 @@ FILE *genb_fopen_tmp(const char *fname)
         return filef;
 }
 
-int genb_fclose_tmp(FILE *filef_tmp, const char *fname)
+int genb_fclose_tmp(FILE *filef_tmp, const char *dirname, const char *fname)
 {
         char *fpath;
         char *tpath;
@@ -99,14 +104,17 @@ int genb_fclose_tmp(FILE *filef_tmp, const char *fname)
         char fbuf[1024];
         size_t trd;
         size_t frd;
+        long size;
 
         if (options->dryrun) {
                 fclose(filef_tmp);
                 return 0;
         }
 
-        fpath = genb_fpath(fname);
-        tpath = genb_fpath_tmp(fname);
+        size = ftell(filef_tmp);
+
+        fpath = genb_fpath(dirname, fname);
+        tpath = genb_fpath_tmp(dirname, fname);
 
         filef = fopen(fpath, "r");
         if (filef == NULL) {
@@ -116,6 +124,7 @@ int genb_fclose_tmp(FILE *filef_tmp, const char *fname)
 
                 remove(fpath);
                 rename(tpath, fpath);
+                stats_file(size, true);
         } else {
                 rewind(filef_tmp);
 
@@ -130,6 +139,7 @@ int genb_fclose_tmp(FILE *filef_tmp, const char *fname)
 
                                 remove(fpath);
                                 rename(tpath, fpath);
+                                stats_file(size, true);
 
                                 goto close_done;
                         }
@@ -141,6 +151,7 @@ int genb_fclose_tmp(FILE *filef_tmp, const char *fname)
                 fclose(filef_tmp);
                 fclose(filef);
                 remove(tpath);
+                stats_file(size, false);
         }
 
 close_done:
@@ -150,6 +161,217 @@ close_done:
         return 0;
 }
 
+/**
+ * read a stream which cannot be mapped into a mapping
+ *
+ * Pipes and terminals have no size so are read until end of file.
+ */
+static char *fmap_stream(FILE *filef, size_t *size_out)
+{
+        char *buf = NULL;
+        size_t alloc = 0;
+        size_t len = 0;
+        size_t rd;
+        size_t size;
+        size_t maplen;
+        long pagesize;
+        char *newbuf;
+        char *map;
+
+        do {
+                if (len == alloc) {
+                        alloc += 65536;
+                        newbuf = realloc(buf, alloc);
+                        if (newbuf == NULL) {
+                                free(buf);
+                                fclose(filef);
+                                return NULL;
+                        }
+                        buf = newbuf;
+                }
+                rd = fread(buf + len, 1, alloc - len, filef);
+                len += rd;
+        } while (rd > 0);
+
+        if (ferror(filef)) {
+                free(buf);
+                fclose(filef);
+                return NULL;
+        }
+        fclose(filef);
+
+        /* the contents and two NUL terminators */
+        size = len + 2;
+        pagesize = sysconf(_SC_PAGESIZE);
+        maplen = ((size + pagesize - 1) / pagesize) * pagesize;
+
+        map = mmap(NULL, maplen, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (map == MAP_FAILED) {
+                free(buf);
+                return NULL;
+        }
+        if (len > 0) {
+                memcpy(map, buf, len);
+        }
+        free(buf);
+
+        *size_out = size;
+        return map;
+}
+
+/* exported function documented in utils.h */
+char *genb_fmap(FILE *filef, size_t *size_out)
+{
+        struct stat st;
+        size_t size;
+        size_t maplen;
+        size_t rd;
+        long pagesize;
+        char *map;
+        void *filemap;
+
+        if (fstat(fileno(filef), &st) != 0) {
+                fclose(filef);
+                return NULL;
+        }
+
+        if (!S_ISREG(st.st_mode)) {
+                return fmap_stream(filef, size_out);
+        }
+
+        /* the file contents and two NUL terminators */
+        size = st.st_size + 2;
+        pagesize = sysconf(_SC_PAGESIZE);
+        maplen = ((size + pagesize - 1) / pagesize) * pagesize;
+
+        /* reserve zero filled space large enough for the terminators */
+        map = mmap(NULL, maplen, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (map == MAP_FAILED) {
+                fclose(filef);
+                return NULL;
+        }
+
+        if (st.st_size > 0) {
+                /* place a private copy on write view of the file over the
+                 * start of the reservation, the remainder of the last page
+                 * is zero filled.
+                 */
+                filemap = mmap(map, st.st_size, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_FIXED, fileno(filef), 0);
+                if (filemap == MAP_FAILED) {
+                        /* not mappable so read contents instead */
+                        rd = fread(map, 1, st.st_size, filef);
+                        if (rd != (size_t)st.st_size) {
+                                munmap(map, maplen);
+                                fclose(filef);
+                                return NULL;
+                        }
+                }
+        }
+
+        fclose(filef);
+
+        *size_out = size;
+        return map;
+}
+
+/* exported function documented in utils.h */
+void genb_funmap(char *map, size_t size)
+{
+        munmap(map, size);
+}
+
+/* exported function documented in utils.h */
+uint32_t genb_hash(const char *text, size_t len)
+{
+        uint32_t hash = 2166136261U;
+
+        while (len-- > 0) {
+                hash ^= (unsigned char)*text++;
+                hash *= 16777619U;
+        }
+        return hash;
+}
+
+/* exported function documented in utils.h */
+uint64_t genb_hash64(const char *text, size_t len)
+{
+        uint64_t hash = 14695981039346656037ULL;
+
+        while (len-- > 0) {
+                hash ^= (unsigned char)*text++;
+                hash *= 1099511628211ULL;
+        }
+        return hash;
+}
+
+
+/**
+ * interned string table
+ *
+ * open addressed hash table of strings shared by all scanners
+ */
+static struct {
+        char **stringv; /**< the table of strings */
+        size_t count; /**< number of strings in the table */
+        size_t size; /**< number of entries in the table */
+        pthread_mutex_t lock; /**< lock for concurrent scanners */
+} intern_table = { NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+
+/* exported function documented in utils.h */
+char *genb_intern(const char *text, size_t len)
+{
+        size_t idx;
+        char *str;
+
+        pthread_mutex_lock(&intern_table.lock);
+
+        if ((intern_table.count * 2) >= intern_table.size) {
+                /* grow table and rehash */
+                char **oldv = intern_table.stringv;
+                size_t oldsize = intern_table.size;
+
+                intern_table.size = (oldsize == 0) ? 1024 : oldsize * 2;
+                intern_table.stringv = calloc(intern_table.size,
+                                              sizeof(char *));
+
+                for (idx = 0; idx < oldsize; idx++) {
+                        size_t nidx;
+
+                        if (oldv[idx] == NULL) {
+                                continue;
+                        }
+                        nidx = genb_hash(oldv[idx], strlen(oldv[idx]));
+                        nidx &= intern_table.size - 1;
+                        while (intern_table.stringv[nidx] != NULL) {
+                                nidx = (nidx + 1) & (intern_table.size - 1);
+                        }
+                        intern_table.stringv[nidx] = oldv[idx];
+                }
+                free(oldv);
+        }
+
+        idx = genb_hash(text, len) & (intern_table.size - 1);
+        while ((str = intern_table.stringv[idx]) != NULL) {
+                if ((strncmp(str, text, len) == 0) && (str[len] == 0)) {
+                        pthread_mutex_unlock(&intern_table.lock);
+                        return str;
+                }
+                idx = (idx + 1) & (intern_table.size - 1);
+        }
+
+        str = strndup(text, len);
+        intern_table.stringv[idx] = str;
+        intern_table.count++;
+        stats_text(len + 1);
+
+        pthread_mutex_unlock(&intern_table.lock);
+
+        return str;
+}
+
 
 #ifdef NEED_STRNDUP
 
@@ -9,18 +9,21 @@
 #ifndef nsgenbind_utils_h
 #define nsgenbind_utils_h
 
+#include <stdint.h>
+
 /**
  * get a pathname with the output prefix prepended
  *
+ * \param dirname output directory.
  * \param fname leaf filename.
  * \return full prefixed path to file caller must free
  */
-char *genb_fpath(const char *fname);
+char *genb_fpath(const char *dirname, const char *fname);
 
 /**
  * Open file allowing for output path prefix
  */
-FILE *genb_fopen(const char *fname, const char *mode);
+FILE *genb_fopen(const char *dirname, const char *fname, const char *mode);
 
 /**
  * Open file allowing for output path prefix
@@ -29,12 +32,61 @@ FILE *genb_fopen(const char *fname, const char *mode);
  * matching close call to check the output is different before touching the
  * target file.
  */
-FILE *genb_fopen_tmp(const char *fname);
+FILE *genb_fopen_tmp(const char *dirname, const char *fname);
 
 /**
  * Close file opened with genb_fopen
  */
-int genb_fclose_tmp(FILE *filef, const char *fname);
+int genb_fclose_tmp(FILE *filef, const char *dirname, const char *fname);
+
+/**
+ * Map an input file into memory for scanning
+ *
+ * The file contents are followed by the two NUL bytes a flex scan buffer
+ * requires. The mapping is private so the scanner may alter it without
+ * changing the file. Files which are not regular, such as pipes, are
+ * read until end of file instead. The file is closed.
+ *
+ * \param filef The file to map.
+ * \param size_out Updated with the length of the contents and terminators.
+ * \return The mapped contents or NULL on error.
+ */
+char *genb_fmap(FILE *filef, size_t *size_out);
+
+/**
+ * Release a mapping made with genb_fmap
+ */
+void genb_funmap(char *map, size_t size);
+
+/**
+ * Hash a block of text
+ *
+ * \param text The text to hash, need not be NUL terminated.
+ * \param len The length of the text.
+ * \return The FNV-1a hash of the text.
+ */
+uint32_t genb_hash(const char *text, size_t len);
+
+/**
+ * Hash a block of text to 64 bits
+ *
+ * \param text The text to hash, need not be NUL terminated.
+ * \param len The length of the text.
+ * \return The 64 bit FNV-1a hash of the text.
+ */
+uint64_t genb_hash64(const char *text, size_t len);
+
+/**
+ * Intern a string
+ *
+ * Identical strings share a single copy. Safe to call from concurrent
+ * scanners.
+ *
+ * \param text The text to intern, need not be NUL terminated.
+ * \param len The length of the text.
+ * \return The interned string which must not be freed or altered.
+ */
+char *genb_intern(const char *text, size_t len);
 
 #if defined(__APPLE__) || defined(_WIN32)
 #define NEED_STRNDUP 1
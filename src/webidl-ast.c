@@ -12,10 +12,13 @@
 #include <string.h>
 #include <errno.h>
 #include <stdarg.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include "utils.h"
 #include "webidl-ast.h"
 #include "options.h"
+#include "stats.h"
 
 /**
  * standard IO handle for parse trace logging.
@@ -23,9 +26,56 @@
 static FILE *webidl_parsetracef;
 
 extern int webidl_debug;
-extern int webidl__flex_debug;
-extern void webidl_restart(FILE*);
-extern int webidl_parse(struct webidl_node **webidl_ast);
+struct yy_buffer_state;
+extern int webidl_lex_init_extra(const char *filename, void **scanner);
+extern int webidl_lex_destroy(void *scanner);
+extern void webidl_set_debug(int debug_flag, void *scanner);
+extern void webidl_set_lineno(int line_number, void *scanner);
+extern struct yy_buffer_state *webidl__scan_buffer(char *base, size_t size, void *scanner);
+extern int webidl_parse(void *scanner,
+                        struct webidl_index *index,
+                        struct webidl_node **webidl_ast);
+
+/**
+ * progress of a pass over an indexed definition
+ */
+enum webidl_index_state {
+        WEBIDL_INDEX_STATE_UNVISITED = 0, /**< not yet processed */
+        WEBIDL_INDEX_STATE_ACTIVE, /**< processing in progress */
+        WEBIDL_INDEX_STATE_DONE, /**< processing complete */
+};
+
+/**
+ * entry in a definition index
+ */
+struct webidl_index_entry {
+        enum webidl_node_type type; /**< type of definition */
+        const char *ident; /**< identifier of the definition */
+        struct webidl_node *node; /**< the definition */
+        enum webidl_index_state state; /**< state of current pass */
+};
+
+/**
+ * open addressed hash table of definitions
+ */
+struct webidl_index {
+        struct webidl_index_entry *entryv; /**< table of entries */
+        size_t count; /**< number of entries in use */
+        size_t size; /**< number of entries in the table */
+};
+
+/**
+ * context for parsing a set of IDL files
+ */
+struct webidl_parse_ctx {
+        const char *outdirname; /**< directory debug output is written to */
+        int filec; /**< number of files */
+        char **filenamev; /**< names of files to parse */
+        struct webidl_node **astv; /**< AST of each file */
+        int *resv; /**< result of parsing each file */
+        int next; /**< index of next file to be parsed */
+        pthread_mutex_t lock; /**< lock on next file index */
+};
 
 struct webidl_node {
 	enum webidl_node_type type; /* the type of the node */
@@ -127,6 +177,7 @@ webidl_node_new(enum webidl_node_type type,
 {
 	struct webidl_node *nn;
 	nn = calloc(1, sizeof(struct webidl_node));
+	stats_node(STATS_AST_WEBIDL, type, 1, sizeof(struct webidl_node));
 	nn->type = type;
 	nn->l = l;
 	nn->r.value = r;
@@ -141,6 +192,7 @@ webidl_new_number_node(enum webidl_node_type type,
 {
 	struct webidl_node *nn;
 	nn = calloc(1, sizeof(struct webidl_node));
+	stats_node(STATS_AST_WEBIDL, type, 1, sizeof(struct webidl_node));
 	nn->type = type;
 	nn->l = l;
 	nn->r.number = number;
@@ -269,6 +321,168 @@ webidl_node_find_type_ident(struct webidl_node *root_node,
 }
 
 
+/**
+ * find the slot for a definition in an index
+ *
+ * \return the slot holding the definition or the empty slot it belongs in.
+ */
+static struct webidl_index_entry *
+webidl_index_slot(struct webidl_index_entry *entryv,
+                  size_t size,
+                  enum webidl_node_type type,
+                  const char *ident)
+{
+        size_t idx;
+
+        idx = (genb_hash(ident, strlen(ident)) + type) & (size - 1);
+        while (entryv[idx].node != NULL) {
+                if ((entryv[idx].type == type) &&
+                    (strcmp(entryv[idx].ident, ident) == 0)) {
+                        break;
+                }
+                idx = (idx + 1) & (size - 1);
+        }
+        return &entryv[idx];
+}
+
+/* exported interface defined in webidl-ast.h */
+int webidl_index_add(struct webidl_index *index,
+                     const char *ident,
+                     struct webidl_node *node)
+{
+        struct webidl_index_entry *entry;
+        size_t idx;
+
+        if ((index->count * 2) >= index->size) {
+                /* grow table and rehash */
+                struct webidl_index_entry *entryv;
+                size_t size;
+
+                size = (index->size == 0) ? 64 : index->size * 2;
+                entryv = calloc(size, sizeof(struct webidl_index_entry));
+                if (entryv == NULL) {
+                        return -1;
+                }
+                for (idx = 0; idx < index->size; idx++) {
+                        if (index->entryv[idx].node != NULL) {
+                                entry = webidl_index_slot(entryv,
+                                                     size,
+                                                     index->entryv[idx].type,
+                                                     index->entryv[idx].ident);
+                                *entry = index->entryv[idx];
+                        }
+                }
+                free(index->entryv);
+                index->entryv = entryv;
+                index->size = size;
+        }
+
+        entry = webidl_index_slot(index->entryv,
+                                  index->size,
+                                  node->type,
+                                  ident);
+        if (entry->node == NULL) {
+                index->count++;
+        }
+        entry->type = node->type;
+        entry->ident = ident;
+        entry->node = node;
+
+        return 0;
+}
+
+/* exported interface defined in webidl-ast.h */
+struct webidl_node *
+webidl_index_find(struct webidl_index *index,
+                  enum webidl_node_type type,
+                  const char *ident)
+{
+        if (index->size == 0) {
+                return NULL;
+        }
+        return webidl_index_slot(index->entryv,
+                                 index->size,
+                                 type,
+                                 ident)->node;
+}
+
+/**
+ * find the index entry of a definition node
+ *
+ * \return the entry or NULL if the node is not the indexed definition.
+ */
+static struct webidl_index_entry *
+webidl_index_entry(struct webidl_index *index, struct webidl_node *node)
+{
+        struct webidl_index_entry *entry;
+        char *ident;
+
+        if ((node == NULL) || (index->size == 0)) {
+                return NULL;
+        }
+
+        ident = webidl_node_gettext(
+                webidl_node_find_type(node->r.node,
+                                      NULL,
+                                      WEBIDL_NODE_TYPE_IDENT));
+        if (ident == NULL) {
+                return NULL;
+        }
+
+        entry = webidl_index_slot(index->entryv, index->size, node->type, ident);
+        if (entry->node != node) {
+                return NULL;
+        }
+        return entry;
+}
+
+/* exported interface defined in webidl-ast.h */
+struct webidl_index *webidl_index_new(struct webidl_node *webidl_ast)
+{
+        struct webidl_index *index;
+        struct webidl_node *node;
+        char *ident;
+
+        index = calloc(1, sizeof(struct webidl_index));
+        if (index == NULL) {
+                return NULL;
+        }
+
+        /* the first definition of a name in the list is kept so the
+         * definition found is the same one webidl_node_find_type_ident()
+         * would find.
+         */
+        for (node = webidl_ast; node != NULL; node = node->l) {
+                if ((node->type != WEBIDL_NODE_TYPE_INTERFACE) &&
+                    (node->type != WEBIDL_NODE_TYPE_DICTIONARY)) {
+                        continue;
+                }
+                ident = webidl_node_gettext(
+                        webidl_node_find_type(node->r.node,
+                                              NULL,
+                                              WEBIDL_NODE_TYPE_IDENT));
+                if ((ident == NULL) ||
+                    (webidl_index_find(index, node->type, ident) != NULL)) {
+                        continue;
+                }
+                if (webidl_index_add(index, ident, node) != 0) {
+                        webidl_index_free(index);
+                        return NULL;
+                }
+        }
+
+        return index;
+}
+
+/* exported interface defined in webidl-ast.h */
+void webidl_index_free(struct webidl_index *index)
+{
+        if (index != NULL) {
+                free(index->entryv);
+                free(index);
+        }
+}
+
 /* exported interface defined in webidl-ast.h */
 char *webidl_node_gettext(struct webidl_node *node)
 {
@@ -357,7 +571,7 @@ struct webidl_node *webidl_node_getnode(struct webidl_node *node)
 }
 
 /* exported interface defined in webidl-ast.h */
-static const char *webidl_node_type_to_str(enum webidl_node_type type)
+const char *webidl_node_type_to_str(enum webidl_node_type type)
 {
 	switch(type) {
 	case WEBIDL_NODE_TYPE_ROOT:
@@ -568,7 +782,7 @@ static int webidl_ast_dump(FILE *dumpf, struct webidl_node *node, int indent)
 }
 
 /* exported interface documented in webidl-ast.h */
-int webidl_dump_ast(struct webidl_node *node)
+int webidl_dump_ast(const char *outdirname, struct webidl_node *node)
 {
         FILE *dumpf;
 
@@ -577,7 +791,7 @@ int webidl_dump_ast(struct webidl_node *node)
                 return 0;
         }
 
-        dumpf = genb_fopen("webidl-ast", "w");
+        dumpf = genb_fopen(outdirname, "webidl-ast", "w");
         if (dumpf == NULL) {
                 return 2;
         }
@@ -590,22 +804,32 @@ int webidl_dump_ast(struct webidl_node *node)
 }
 
 /* exported interface defined in webidl-ast.h */
-static FILE *idlopen(const char *filename)
+char *webidl_filepath(const char *filename)
 {
-	FILE *idlfile;
 	char *fullname;
 	int fulllen;
 
 	if (options->idlpath == NULL) {
-		if (options->verbose) {
-			printf("Opening IDL file %s\n", filename);
-		}
-		return fopen(filename, "r");
+		return strdup(filename);
 	}
 
 	fulllen = strlen(options->idlpath) + strlen(filename) + 2;
 	fullname = malloc(fulllen);
-	snprintf(fullname, fulllen, "%s/%s", options->idlpath, filename);
+	if (fullname != NULL) {
+		snprintf(fullname, fulllen, "%s/%s", options->idlpath, filename);
+	}
+	return fullname;
+}
+
+static FILE *idlopen(const char *filename)
+{
+	FILE *idlfile;
+	char *fullname;
+
+	fullname = webidl_filepath(filename);
+	if (fullname == NULL) {
+		return NULL;
+	}
 	if (options->verbose) {
 		printf("Opening IDL file %s\n", fullname);
 	}
@@ -616,9 +840,15 @@ static FILE *idlopen(const char *filename)
 }
 
 /* exported interface defined in webidl-ast.h */
-int webidl_parsefile(char *filename, struct webidl_node **webidl_ast)
+int webidl_parsefile(char *filename,
+                     const char *outdirname,
+                     struct webidl_node **webidl_ast)
 {
 	FILE *idlfile;
+        char *idlmap;
+        size_t idlmapsize;
+        void *scanner;
+        struct webidl_index *index;
         int ret;
 
 	idlfile = idlopen(filename);
@@ -629,27 +859,56 @@ int webidl_parsefile(char *filename, struct webidl_node **webidl_ast)
 		return 2;
 	}
 
+        idlmap = genb_fmap(idlfile, &idlmapsize);
+        if (idlmap == NULL) {
+		fprintf(stderr, "Error reading %s: %s\n",
+			filename,
+			strerror(errno));
+		return 2;
+        }
+
+        index = webidl_index_new(*webidl_ast);
+        if (index == NULL) {
+                genb_funmap(idlmap, idlmapsize);
+                return 2;
+        }
+
+        /* the scanner carries the file name for error reports */
+        if (webidl_lex_init_extra(filename, &scanner) != 0) {
+                webidl_index_free(index);
+                genb_funmap(idlmap, idlmapsize);
+                return 2;
+        }
+
         /* if debugging enabled enable parser tracing and send to file */
         if (options->debug) {
                 char *tracename;
                 int tracenamelen;
 		webidl_debug = 1;
-		webidl__flex_debug = 1;
+		webidl_set_debug(1, scanner);
 
                 tracenamelen = SLEN("webidl--trace") + strlen(filename) + 1;
                 tracename = malloc(tracenamelen);
                 snprintf(tracename, tracenamelen,"webidl-%s-trace", filename);
-                webidl_parsetracef = genb_fopen(tracename, "w");
+                webidl_parsetracef = genb_fopen(outdirname, tracename, "w");
                 free(tracename);
         } else {
                 webidl_parsetracef = NULL;
         }
 
-	/* set flex to read from file */
-	webidl_restart(idlfile);
+	/* set flex to scan the mapped file, the buffer state is deleted
+	 * when the end of file rule pops it or by webidl_lex_destroy()
+	 * if the parse stops early
+	 */
+	webidl__scan_buffer(idlmap, idlmapsize, scanner);
+        webidl_set_lineno(1, scanner);
 
 	/* parse the file */
-	ret = webidl_parse(webidl_ast);
+	ret = webidl_parse(scanner, index, webidl_ast);
+
+        webidl_lex_destroy(scanner);
+        webidl_index_free(index);
+        genb_funmap(idlmap, idlmapsize);
 
         /* close tracefile if open */
         if (webidl_parsetracef != NULL) {
@@ -658,6 +917,289 @@ int webidl_parsefile(char *filename, struct webidl_node **webidl_ast)
         return ret;
 }
 
+/**
+ * parse files from a parse context until there are none left
+ */
+static void *webidl_parse_worker(void *ctx)
+{
+        struct webidl_parse_ctx *pctx = ctx;
+        int idx;
+
+        for (;;) {
+                pthread_mutex_lock(&pctx->lock);
+                idx = pctx->next++;
+                pthread_mutex_unlock(&pctx->lock);
+
+                if (idx >= pctx->filec) {
+                        break;
+                }
+
+                pctx->resv[idx] = webidl_parsefile(pctx->filenamev[idx],
+                                                   pctx->outdirname,
+                                                   &pctx->astv[idx]);
+        }
+
+        return NULL;
+}
+
+/**
+ * copy a list of nodes
+ *
+ * Only the list is copied, the values of the nodes are shared.
+ */
+static struct webidl_node *webidl_node_copy_list(struct webidl_node *list)
+{
+        struct webidl_node *copy = NULL;
+        struct webidl_node **tail = &copy;
+
+        while (list != NULL) {
+                *tail = malloc(sizeof(struct webidl_node));
+                **tail = *list;
+                stats_node(STATS_AST_WEBIDL, list->type, 1,
+                           sizeof(struct webidl_node));
+                (*tail)->l = NULL;
+                tail = &(*tail)->l;
+                list = list->l;
+        }
+        return copy;
+}
+
+/**
+ * merge the members of a definition into an existing definition
+ *
+ * The identifier and extended attributes of the merged definition are
+ * discarded as they would have been had the definition been parsed
+ * after the existing one.
+ */
+static void
+webidl_merge_members(struct webidl_node *existing, struct webidl_node *node)
+{
+        struct webidl_node *child;
+        struct webidl_node *next;
+        struct webidl_node *members = NULL;
+
+        child = node->r.node;
+        while (child != NULL) {
+                next = child->l;
+                child->l = NULL;
+                if ((child->type != WEBIDL_NODE_TYPE_IDENT) &&
+                    (child->type != WEBIDL_NODE_TYPE_EXTENDED_ATTRIBUTE)) {
+                        members = webidl_node_append(members, child);
+                } else {
+                        free(child);
+                }
+                child = next;
+        }
+
+        webidl_node_add(existing, members);
+}
+
+/**
+ * merge the definitions parsed from one file into an AST
+ *
+ * Definitions are merged in the order they appeared in the file so
+ * partial interfaces and dictionaries are combined exactly as if the
+ * file had been parsed directly into the AST. The file AST is not
+ * altered, each definition and its list of children is copied so the
+ * file may be merged into several ASTs.
+ *
+ * \param index The index of definitions in the AST.
+ * \param webidl_ast The AST to merge into, updated on return.
+ * \param file_ast The definitions from a file.
+ * \return 0 on success else -1 on allocation error.
+ */
+static int
+webidl_merge_definitions(struct webidl_index *index,
+                         struct webidl_node **webidl_ast,
+                         struct webidl_node *file_ast)
+{
+        struct webidl_node **defv;
+        struct webidl_node *node;
+        struct webidl_node *existing;
+        char *ident;
+        int defc;
+        int idx;
+
+        /* definitions are prepended as they are parsed so reverse them */
+        defc = 0;
+        for (node = file_ast; node != NULL; node = node->l) {
+                defc++;
+        }
+        defv = malloc((defc + 1) * sizeof(struct webidl_node *));
+        if (defv == NULL) {
+                return -1;
+        }
+        idx = defc;
+        for (node = file_ast; node != NULL; node = node->l) {
+                defv[--idx] = node;
+        }
+
+        for (idx = 0; idx < defc; idx++) {
+                node = malloc(sizeof(struct webidl_node));
+                if (node == NULL) {
+                        free(defv);
+                        return -1;
+                }
+                *node = *defv[idx];
+                stats_node(STATS_AST_WEBIDL, node->type, 1,
+                           sizeof(struct webidl_node));
+                node->l = NULL;
+
+                existing = NULL;
+                ident = NULL;
+                if ((node->type == WEBIDL_NODE_TYPE_INTERFACE) ||
+                    (node->type == WEBIDL_NODE_TYPE_DICTIONARY)) {
+                        node->r.node = webidl_node_copy_list(node->r.node);
+                        ident = webidl_node_gettext(
+                                webidl_node_find_type(node->r.node,
+                                                      NULL,
+                                                      WEBIDL_NODE_TYPE_IDENT));
+                        if (ident != NULL) {
+                                existing = webidl_index_find(index,
+                                                             node->type,
+                                                             ident);
+                        }
+                }
+
+                if (existing == NULL) {
+                        *webidl_ast = webidl_node_prepend(*webidl_ast, node);
+                        if ((ident != NULL) &&
+                            (webidl_index_add(index, ident, node) != 0)) {
+                                free(defv);
+                                return -1;
+                        }
+                } else {
+                        webidl_merge_members(existing, node);
+                        free(node);
+                }
+        }
+        free(defv);
+
+        return 0;
+}
+
+/* exported interface defined in webidl-ast.h */
+int webidl_merge(int filec,
+                 struct webidl_node **astv,
+                 struct webidl_node **webidl_ast)
+{
+        struct webidl_index *index;
+        int idx;
+
+        index = webidl_index_new(*webidl_ast);
+        if (index == NULL) {
+                return -1;
+        }
+
+        /* combine the per file ASTs in the order the files were given */
+        for (idx = 0; idx < filec; idx++) {
+                if (webidl_merge_definitions(index,
+                                             webidl_ast,
+                                             astv[idx]) != 0) {
+                        webidl_index_free(index);
+                        return -1;
+                }
+        }
+        webidl_index_free(index);
+
+        return 0;
+}
+
+/* exported interface defined in webidl-ast.h */
+void webidl_merge_free(struct webidl_node *webidl_ast)
+{
+        struct webidl_node *next;
+        struct webidl_node *child;
+
+        while (webidl_ast != NULL) {
+                next = webidl_ast->l;
+                if ((webidl_ast->type == WEBIDL_NODE_TYPE_INTERFACE) ||
+                    (webidl_ast->type == WEBIDL_NODE_TYPE_DICTIONARY)) {
+                        /* only the list of children was copied */
+                        while (webidl_ast->r.node != NULL) {
+                                child = webidl_ast->r.node;
+                                webidl_ast->r.node = child->l;
+                                free(child);
+                        }
+                }
+                free(webidl_ast);
+                webidl_ast = next;
+        }
+}
+
+/* exported interface defined in webidl-ast.h */
+int webidl_parsefiles(const char *outdirname,
+                      int filec,
+                      char **filenamev,
+                      struct webidl_node **astv)
+{
+        struct webidl_parse_ctx pctx;
+        pthread_t *threadv = NULL;
+        long threadc = 0;
+        long tidx;
+        int idx;
+        int ret = 0;
+
+        if (filec == 0) {
+                return 0;
+        }
+
+        pctx.outdirname = outdirname;
+        pctx.filec = filec;
+        pctx.filenamev = filenamev;
+        pctx.astv = astv;
+        pctx.resv = calloc(filec, sizeof(int));
+        pctx.next = 0;
+        if (pctx.resv == NULL) {
+                return -1;
+        }
+        pthread_mutex_init(&pctx.lock, NULL);
+
+        /* parser tracing uses global state so debug parses serially */
+        if (!options->debug) {
+                threadc = sysconf(_SC_NPROCESSORS_ONLN);
+                if (threadc > filec) {
+                        threadc = filec;
+                }
+                /* the calling thread is a worker too */
+                threadc--;
+        }
+
+        if (threadc > 0) {
+                threadv = calloc(threadc, sizeof(pthread_t));
+                if (threadv == NULL) {
+                        threadc = 0;
+                }
+        }
+
+        for (tidx = 0; tidx < threadc; tidx++) {
+                if (pthread_create(&threadv[tidx], NULL,
+                                   webidl_parse_worker, &pctx) != 0) {
+                        break;
+                }
+        }
+        threadc = tidx;
+
+        webidl_parse_worker(&pctx);
+
+        for (tidx = 0; tidx < threadc; tidx++) {
+                pthread_join(threadv[tidx], NULL);
+        }
+        free(threadv);
+        pthread_mutex_destroy(&pctx.lock);
+
+        /* report the first file in order which failed */
+        for (idx = 0; idx < filec; idx++) {
+                if (pctx.resv[idx] != 0) {
+                        ret = pctx.resv[idx];
+                        break;
+                }
+        }
+        free(pctx.resv);
+
+        return ret;
+}
+
 /* exported interface defined in webidl-ast.h */
 int webidl_fprintf(FILE *stream, const char *format, ...)
 {
@@ -676,8 +1218,8 @@ int webidl_fprintf(FILE *stream, const char *format, ...)
         return ret;
 }
 
-/* unlink a child node from a parent */
-static int
+/* exported interface documented in webidl-ast.h */
+int
 webidl_unlink(struct webidl_node *parent, struct webidl_node *node)
 {
 	struct webidl_node *child;
@@ -707,6 +1249,12 @@ webidl_unlink(struct webidl_node *parent, struct webidl_node *node)
 	return -1; /* failed to remove node */
 }
 
+/**
+ * add the member lists of an interface to another
+ *
+ * The member lists are shared, only the list nodes referring to them
+ * are created.
+ */
 static int implements_copy_nodes(struct webidl_node *src_node,
 				 struct webidl_node *dst_node)
 {
@@ -729,12 +1277,35 @@ static int implements_copy_nodes(struct webidl_node *src_node,
 	return 0;
 }
 
+/**
+ * intercalate the implements of an interface
+ *
+ * Each interface is flattened once, an interface implementing itself
+ * directly or indirectly is an error.
+ */
 static int
 intercalate_implements(struct webidl_node *interface_node, void *ctx)
 {
 	struct webidl_node *implements_node;
 	struct webidl_node *implements_interface_node;
-	struct webidl_node *webidl_ast = ctx;
+	struct webidl_index *index = ctx;
+        struct webidl_index_entry *entry;
+        int res;
+
+        entry = webidl_index_entry(index, interface_node);
+        if (entry != NULL) {
+                if (entry->state == WEBIDL_INDEX_STATE_DONE) {
+                        /* already flattened */
+                        return 0;
+                }
+                if (entry->state == WEBIDL_INDEX_STATE_ACTIVE) {
+                        fprintf(stderr,
+                                "Error: implements of interface %s form a cycle\n",
+                                entry->ident);
+                        return -1;
+                }
+                entry->state = WEBIDL_INDEX_STATE_ACTIVE;
+        }
 
 	implements_node = webidl_node_find_type(
 		webidl_node_getnode(interface_node),
@@ -742,34 +1313,47 @@ intercalate_implements(struct webidl_node *interface_node, void *ctx)
 		WEBIDL_NODE_TYPE_INTERFACE_IMPLEMENTS);
 	while (implements_node != NULL) {
 
-		implements_interface_node = webidl_node_find_type_ident(
-			webidl_ast,
+		implements_interface_node = webidl_index_find(
+			index,
 			WEBIDL_NODE_TYPE_INTERFACE,
 			webidl_node_gettext(implements_node));
 
 		/* recurse, ensuring all subordinate interfaces have
 		 * their implements intercalated first
 		 */
-		intercalate_implements(implements_interface_node, webidl_ast);
+		res = intercalate_implements(implements_interface_node, index);
+                if (res != 0) {
+                        return res;
+                }
 
 		implements_copy_nodes(implements_interface_node, interface_node);
 
 		/* once we have copied the implemntation remove entry */
 		webidl_unlink(interface_node, implements_node);
+		webidl_ast_free(implements_node);
 
 		implements_node = webidl_node_find_type(
 			webidl_node_getnode(interface_node),
-			implements_node,
+			NULL,
 			WEBIDL_NODE_TYPE_INTERFACE_IMPLEMENTS);
 	}
+
+        if (entry != NULL) {
+                entry->state = WEBIDL_INDEX_STATE_DONE;
+        }
 	return 0;
 }
 
 /* exported interface defined in webidl-ast.h */
 int webidl_intercalate_implements(struct webidl_node *webidl_ast)
 {
+        struct webidl_index *index;
         int res = 0;
         if (webidl_ast != NULL) {
+                index = webidl_index_new(webidl_ast);
+                if (index == NULL) {
+                        return -1;
+                }
                 /* for each interface:
                  *   for each implements entry:
                  *     find interface from implemets
@@ -779,7 +1363,8 @@ int webidl_intercalate_implements(struct webidl_node *webidl_ast)
                 res = webidl_node_for_each_type(webidl_ast,
                                                 WEBIDL_NODE_TYPE_INTERFACE,
                                                 intercalate_implements,
-                                                webidl_ast);
+                                                index);
+                webidl_index_free(index);
         }
         return res;
 }
@@ -843,3 +1428,913 @@ const char *webidl_type_to_str(enum webidl_type_modifier m, enum webidl_type t)
         }
         return "Unknown";
 }
+
+
+/* IDL cache */
+
+#define WEBIDL_CACHE_MAGIC 0x43444931 /* "1IDC" in little endian */
+#define WEBIDL_CACHE_VERSION 2
+
+/**
+ * IDL cache file header
+ *
+ * All values are in host byte order, a cache file is only valid on
+ * the kind of host that wrote it which the magic value checks. The
+ * header is followed by the source manifest padded to a multiple of
+ * four bytes, the nodes and the string table.
+ */
+struct webidl_cache_header {
+        uint32_t magic; /**< identifies file as a cache */
+        uint32_t version; /**< format version */
+        uint32_t keysize; /**< size of the source manifest */
+        uint32_t nodec; /**< number of nodes */
+        uint32_t strsize; /**< size of string table */
+        uint32_t root; /**< root node index */
+};
+
+/**
+ * IDL cache node
+ *
+ * Nodes are referred to by index plus one so zero is NULL.
+ */
+struct webidl_cache_node {
+        uint32_t type; /**< node type */
+        uint32_t l; /**< sibling node */
+        uint32_t r; /**< node, string offset, number or float bits */
+};
+
+/**
+ * how the value of a node is stored
+ */
+enum webidl_cache_value {
+        WEBIDL_CACHE_VALUE_NONE,
+        WEBIDL_CACHE_VALUE_NODE,
+        WEBIDL_CACHE_VALUE_TEXT,
+        WEBIDL_CACHE_VALUE_NUMBER,
+        WEBIDL_CACHE_VALUE_FLOAT,
+};
+
+/**
+ * map of pointers to cache values used while writing a cache
+ */
+struct webidl_cache_map {
+        const void **keyv; /**< pointers */
+        uint32_t *valuev; /**< values */
+        size_t count; /**< number of entries in use */
+        size_t size; /**< number of entries */
+};
+
+/**
+ * state while writing a cache
+ */
+struct webidl_cache_ctx {
+        struct webidl_cache_map nodemap; /**< node to index map */
+        struct webidl_cache_map strmap; /**< string to offset map */
+        struct webidl_cache_node *nodev; /**< cache nodes */
+        size_t nodec; /**< number of cache nodes */
+        size_t nodealloc; /**< allocated cache nodes */
+        char *str; /**< string table */
+        size_t strsize; /**< length of string table */
+        size_t stralloc; /**< allocated string table */
+};
+
+static enum webidl_cache_value
+webidl_cache_value_type(enum webidl_node_type type)
+{
+        switch (type) {
+        case WEBIDL_NODE_TYPE_ROOT:
+        case WEBIDL_NODE_TYPE_INTERFACE:
+        case WEBIDL_NODE_TYPE_DICTIONARY:
+        case WEBIDL_NODE_TYPE_LIST:
+        case WEBIDL_NODE_TYPE_EXTENDED_ATTRIBUTE:
+        case WEBIDL_NODE_TYPE_ATTRIBUTE:
+        case WEBIDL_NODE_TYPE_OPERATION:
+        case WEBIDL_NODE_TYPE_OPTIONAL:
+        case WEBIDL_NODE_TYPE_ARGUMENT:
+        case WEBIDL_NODE_TYPE_TYPE:
+        case WEBIDL_NODE_TYPE_CONST:
+                return WEBIDL_CACHE_VALUE_NODE;
+
+        case WEBIDL_NODE_TYPE_IDENT:
+        case WEBIDL_NODE_TYPE_INHERITANCE:
+        case WEBIDL_NODE_TYPE_INTERFACE_IMPLEMENTS:
+        case WEBIDL_NODE_TYPE_LITERAL_STRING:
+                return WEBIDL_CACHE_VALUE_TEXT;
+
+        case WEBIDL_NODE_TYPE_MODIFIER:
+        case WEBIDL_NODE_TYPE_TYPE_BASE:
+        case WEBIDL_NODE_TYPE_LITERAL_INT:
+        case WEBIDL_NODE_TYPE_SPECIAL:
+        case WEBIDL_NODE_TYPE_LITERAL_BOOL:
+                return WEBIDL_CACHE_VALUE_NUMBER;
+
+        case WEBIDL_NODE_TYPE_LITERAL_FLOAT:
+                return WEBIDL_CACHE_VALUE_FLOAT;
+
+        default:
+                break;
+        }
+        return WEBIDL_CACHE_VALUE_NONE;
+}
+
+/* exported interface defined in webidl-ast.h */
+void webidl_ast_free(struct webidl_node *webidl_ast)
+{
+        struct webidl_node *next;
+
+        while (webidl_ast != NULL) {
+                next = webidl_ast->l;
+                switch (webidl_cache_value_type(webidl_ast->type)) {
+                case WEBIDL_CACHE_VALUE_NODE:
+                        webidl_ast_free(webidl_ast->r.node);
+                        break;
+
+                case WEBIDL_CACHE_VALUE_FLOAT:
+                        free(webidl_ast->r.flt);
+                        break;
+
+                default:
+                        /* text is interned so is retained */
+                        break;
+                }
+                free(webidl_ast);
+                webidl_ast = next;
+        }
+}
+
+/**
+ * find the slot for a pointer in a cache map
+ */
+static size_t webidl_cache_map_slot(const void **keyv, size_t size, const void *key)
+{
+        size_t idx;
+
+        idx = (((uintptr_t)key >> 3) * 2654435761U) & (size - 1);
+        while ((keyv[idx] != NULL) && (keyv[idx] != key)) {
+                idx = (idx + 1) & (size - 1);
+        }
+        return idx;
+}
+
+/**
+ * find a pointer in a cache map
+ *
+ * \return true and the value updated if the pointer was found
+ */
+static bool
+webidl_cache_map_find(struct webidl_cache_map *map,
+                      const void *key,
+                      uint32_t *value_out)
+{
+        size_t idx;
+
+        if (map->size == 0) {
+                return false;
+        }
+        idx = webidl_cache_map_slot(map->keyv, map->size, key);
+        if (map->keyv[idx] == NULL) {
+                return false;
+        }
+        *value_out = map->valuev[idx];
+        return true;
+}
+
+/**
+ * add a pointer to a cache map
+ */
+static int
+webidl_cache_map_add(struct webidl_cache_map *map,
+                     const void *key,
+                     uint32_t value)
+{
+        size_t idx;
+
+        if ((map->count * 2) >= map->size) {
+                const void **keyv;
+                uint32_t *valuev;
+                size_t size;
+                size_t nidx;
+
+                size = (map->size == 0) ? 1024 : map->size * 2;
+                keyv = calloc(size, sizeof(void *));
+                valuev = calloc(size, sizeof(uint32_t));
+                if ((keyv == NULL) || (valuev == NULL)) {
+                        free(keyv);
+                        free(valuev);
+                        return -1;
+                }
+                for (idx = 0; idx < map->size; idx++) {
+                        if (map->keyv[idx] != NULL) {
+                                nidx = webidl_cache_map_slot(keyv,
+                                                             size,
+                                                             map->keyv[idx]);
+                                keyv[nidx] = map->keyv[idx];
+                                valuev[nidx] = map->valuev[idx];
+                        }
+                }
+                free(map->keyv);
+                free(map->valuev);
+                map->keyv = keyv;
+                map->valuev = valuev;
+                map->size = size;
+        }
+
+        idx = webidl_cache_map_slot(map->keyv, map->size, key);
+        map->keyv[idx] = key;
+        map->valuev[idx] = value;
+        map->count++;
+
+        return 0;
+}
+
+/**
+ * add a string to the cache string table
+ *
+ * \return 0 on success or -1 on error
+ */
+static int
+webidl_cache_string(struct webidl_cache_ctx *cctx,
+                    const char *text,
+                    uint32_t *offset_out)
+{
+        size_t len;
+
+        if (webidl_cache_map_find(&cctx->strmap, text, offset_out)) {
+                return 0;
+        }
+
+        len = strlen(text) + 1;
+        if ((cctx->strsize + len) > cctx->stralloc) {
+                char *str;
+                size_t alloc = cctx->stralloc;
+
+                do {
+                        alloc = (alloc == 0) ? 16384 : alloc * 2;
+                } while ((cctx->strsize + len) > alloc);
+
+                str = realloc(cctx->str, alloc);
+                if (str == NULL) {
+                        return -1;
+                }
+                cctx->str = str;
+                cctx->stralloc = alloc;
+        }
+        memcpy(cctx->str + cctx->strsize, text, len);
+        *offset_out = cctx->strsize;
+        cctx->strsize += len;
+
+        return webidl_cache_map_add(&cctx->strmap, text, *offset_out);
+}
+
+/**
+ * add a node and all nodes reachable from it to a cache
+ *
+ * Nodes reachable by more than one route, such as intercalated member
+ * lists, are only stored once.
+ *
+ * \return 0 on success or -1 on error
+ */
+static int
+webidl_cache_node(struct webidl_cache_ctx *cctx,
+                  struct webidl_node *node,
+                  uint32_t *ref_out)
+{
+        uint32_t ref;
+        uint32_t l;
+        uint32_t r = 0;
+        size_t idx;
+
+        if (node == NULL) {
+                *ref_out = 0;
+                return 0;
+        }
+
+        if (webidl_cache_map_find(&cctx->nodemap, node, ref_out)) {
+                return 0;
+        }
+
+        if (cctx->nodec == cctx->nodealloc) {
+                struct webidl_cache_node *nodev;
+                size_t alloc;
+
+                alloc = (cctx->nodealloc == 0) ? 4096 : cctx->nodealloc * 2;
+                nodev = realloc(cctx->nodev,
+                                alloc * sizeof(struct webidl_cache_node));
+                if (nodev == NULL) {
+                        return -1;
+                }
+                cctx->nodev = nodev;
+                cctx->nodealloc = alloc;
+        }
+        idx = cctx->nodec++;
+        ref = idx + 1;
+        if (webidl_cache_map_add(&cctx->nodemap, node, ref) != 0) {
+                return -1;
+        }
+
+        switch (webidl_cache_value_type(node->type)) {
+        case WEBIDL_CACHE_VALUE_NODE:
+                if (webidl_cache_node(cctx, node->r.node, &r) != 0) {
+                        return -1;
+                }
+                break;
+
+        case WEBIDL_CACHE_VALUE_TEXT:
+                if (node->r.text != NULL) {
+                        if (webidl_cache_string(cctx, node->r.text, &r) != 0) {
+                                return -1;
+                        }
+                        r++; /* zero is reserved for no text */
+                }
+                break;
+
+        case WEBIDL_CACHE_VALUE_NUMBER:
+                r = (uint32_t)node->r.number;
+                break;
+
+        case WEBIDL_CACHE_VALUE_FLOAT:
+                memcpy(&r, node->r.flt, sizeof(r));
+                break;
+
+        case WEBIDL_CACHE_VALUE_NONE:
+                if (node->r.value != NULL) {
+                        fprintf(stderr,
+                                "Error: unable to cache %s node\n",
+                                webidl_node_type_to_str(node->type));
+                        return -1;
+                }
+                break;
+        }
+
+        if (webidl_cache_node(cctx, node->l, &l) != 0) {
+                return -1;
+        }
+
+        /* nodes array may have moved during recursion */
+        cctx->nodev[idx].type = node->type;
+        cctx->nodev[idx].l = l;
+        cctx->nodev[idx].r = r;
+
+        *ref_out = ref;
+        return 0;
+}
+
+/**
+ * files named by #include directives
+ */
+struct webidl_include_list {
+        int count; /**< number of names */
+        int alloc; /**< number of names the vector holds */
+        char **namev; /**< included file names */
+};
+
+/**
+ * add an included file name to a list unless already present
+ */
+static int
+include_list_add(struct webidl_include_list *list, const char *name, size_t len)
+{
+        char **namev;
+        int idx;
+
+        for (idx = 0; idx < list->count; idx++) {
+                if ((strlen(list->namev[idx]) == len) &&
+                    (strncmp(list->namev[idx], name, len) == 0)) {
+                        return 0;
+                }
+        }
+
+        if (list->count == list->alloc) {
+                namev = realloc(list->namev,
+                                (list->alloc + 8) * sizeof(char *));
+                if (namev == NULL) {
+                        return -1;
+                }
+                list->namev = namev;
+                list->alloc += 8;
+        }
+
+        list->namev[list->count] = strndup(name, len);
+        if (list->namev[list->count] == NULL) {
+                return -1;
+        }
+        list->count++;
+
+        return 0;
+}
+
+/**
+ * add the files named by the #include directives in IDL text to a list
+ *
+ * Directives are matched as the lexer matches them, a line starting
+ * with #include followed by a quoted name. Comments and string
+ * literals are skipped so directives within them are not matched.
+ */
+static int
+include_list_scan(struct webidl_include_list *list,
+                  const char *map,
+                  size_t size)
+{
+        const char *cur = map;
+        const char *end = map + size;
+        const char *name;
+        bool comment = false; /* within a block comment */
+
+        while (cur < end) {
+                while ((cur < end) && ((*cur == ' ') || (*cur == '\t'))) {
+                        cur++;
+                }
+                if (!comment &&
+                    ((end - cur) > 8) &&
+                    (strncmp(cur, "#include", 8) == 0)) {
+                        cur += 8;
+                        while ((cur < end) &&
+                               ((*cur == ' ') || (*cur == '\t'))) {
+                                cur++;
+                        }
+                        if ((cur < end) && (*cur == '"')) {
+                                name = ++cur;
+                                while ((cur < end) && (*cur != '"') &&
+                                       (*cur != '\t') && (*cur != '\n')) {
+                                        cur++;
+                                }
+                                if ((cur > name) &&
+                                    (include_list_add(list,
+                                                      name,
+                                                      cur - name) != 0)) {
+                                        return -1;
+                                }
+                                if ((cur < end) && (*cur == '"')) {
+                                        cur++;
+                                }
+                        }
+                }
+
+                /* skip the rest of the line tracking comments */
+                while ((cur < end) && (*cur != '\n')) {
+                        if (comment) {
+                                if ((*cur == '*') &&
+                                    ((cur + 1) < end) && (cur[1] == '/')) {
+                                        comment = false;
+                                        cur++;
+                                }
+                        } else if ((*cur == '/') &&
+                                   ((cur + 1) < end) && (cur[1] == '*')) {
+                                comment = true;
+                                cur++;
+                        } else if ((*cur == '/') &&
+                                   ((cur + 1) < end) && (cur[1] == '/')) {
+                                while ((cur < end) && (*cur != '\n')) {
+                                        cur++;
+                                }
+                                break;
+                        } else if (*cur == '"') {
+                                cur++;
+                                while ((cur < end) &&
+                                       (*cur != '"') && (*cur != '\n')) {
+                                        cur++;
+                                }
+                                if ((cur >= end) || (*cur == '\n')) {
+                                        break;
+                                }
+                        }
+                        cur++;
+                }
+                cur++;
+        }
+
+        return 0;
+}
+
+/**
+ * map an included file and add the files it includes to the list
+ *
+ * The lexer opens included files relative to the working directory
+ * so they are not looked for on the IDL path.
+ */
+static char *
+include_list_map(struct webidl_include_list *list, int idx, size_t *size_out)
+{
+        FILE *incfile;
+        char *incmap;
+
+        incfile = fopen(list->namev[idx], "r");
+        if (incfile == NULL) {
+                return NULL;
+        }
+        incmap = genb_fmap(incfile, size_out);
+        if (incmap == NULL) {
+                return NULL;
+        }
+        if (include_list_scan(list, incmap, *size_out) != 0) {
+                genb_funmap(incmap, *size_out);
+                return NULL;
+        }
+        return incmap;
+}
+
+static void include_list_free(struct webidl_include_list *list)
+{
+        int idx;
+
+        for (idx = 0; idx < list->count; idx++) {
+                free(list->namev[idx]);
+        }
+        free(list->namev);
+}
+
+/* exported interface defined in webidl-ast.h */
+int webidl_includes(const char *filename, int *includec_out, char ***includev_out)
+{
+        struct webidl_include_list list = { 0, 0, NULL };
+        FILE *idlfile;
+        char *idlmap;
+        size_t idlmapsize;
+        int idx;
+        int ret;
+
+        idlfile = idlopen(filename);
+        if (idlfile == NULL) {
+                return -1;
+        }
+        idlmap = genb_fmap(idlfile, &idlmapsize);
+        if (idlmap == NULL) {
+                return -1;
+        }
+        ret = include_list_scan(&list, idlmap, idlmapsize);
+        genb_funmap(idlmap, idlmapsize);
+
+        /* files missing now are still listed so they are seen appearing */
+        for (idx = 0; (ret == 0) && (idx < list.count); idx++) {
+                idlmap = include_list_map(&list, idx, &idlmapsize);
+                if (idlmap != NULL) {
+                        genb_funmap(idlmap, idlmapsize);
+                }
+        }
+
+        if (ret != 0) {
+                include_list_free(&list);
+                return -1;
+        }
+
+        *includec_out = list.count;
+        *includev_out = list.namev;
+
+        return 0;
+}
+
+/**
+ * add the name, length and content hash of a file to the cache key text
+ */
+static int
+cache_key_add(char **keytext,
+              size_t *keylen,
+              size_t *keyalloc,
+              const char *name,
+              const char *map,
+              size_t size)
+{
+        size_t namelen = strlen(name) + 1;
+        uint64_t value;
+        char *newtext;
+
+        if ((*keylen + namelen + (2 * sizeof(uint64_t))) > *keyalloc) {
+                newtext = realloc(*keytext,
+                                  *keyalloc + namelen + 256);
+                if (newtext == NULL) {
+                        return -1;
+                }
+                *keytext = newtext;
+                *keyalloc += namelen + 256;
+        }
+
+        memcpy(*keytext + *keylen, name, namelen);
+        *keylen += namelen;
+        value = size;
+        memcpy(*keytext + *keylen, &value, sizeof(value));
+        *keylen += sizeof(value);
+        value = genb_hash64(map, size);
+        memcpy(*keytext + *keylen, &value, sizeof(value));
+        *keylen += sizeof(value);
+
+        return 0;
+}
+
+/* exported interface defined in webidl-ast.h */
+int webidl_cache_key(int filec,
+                     char **filenamev,
+                     char **key_out,
+                     size_t *keylen_out)
+{
+        struct webidl_include_list list = { 0, 0, NULL };
+        FILE *idlfile;
+        char *idlmap;
+        size_t idlmapsize;
+        char *idlpath;
+        char *keytext;
+        size_t keylen = 0;
+        size_t keyalloc = 0;
+        int idx;
+        int ret = 0;
+
+        keyalloc = 64;
+        for (idx = 0; idx < filec; idx++) {
+                keyalloc += strlen(filenamev[idx]) + 1 + (2 * sizeof(uint64_t));
+        }
+        keytext = malloc(keyalloc);
+        if (keytext == NULL) {
+                return -1;
+        }
+
+        keylen = snprintf(keytext, keyalloc, "%u %d:",
+                          WEBIDL_CACHE_VERSION, filec);
+
+        /* key on the path, length and content of each file */
+        for (idx = 0; idx < filec; idx++) {
+                idlfile = idlopen(filenamev[idx]);
+                if (idlfile == NULL) {
+                        ret = -1;
+                        break;
+                }
+                idlmap = genb_fmap(idlfile, &idlmapsize);
+                if (idlmap == NULL) {
+                        ret = -1;
+                        break;
+                }
+                ret = include_list_scan(&list, idlmap, idlmapsize);
+                idlpath = webidl_filepath(filenamev[idx]);
+                if (idlpath == NULL) {
+                        ret = -1;
+                }
+                if (ret == 0) {
+                        ret = cache_key_add(&keytext, &keylen, &keyalloc,
+                                            idlpath,
+                                            idlmap, idlmapsize);
+                }
+                free(idlpath);
+                genb_funmap(idlmap, idlmapsize);
+                if (ret != 0) {
+                        break;
+                }
+        }
+
+        /* and on every file they include, an unreadable one is not cached */
+        for (idx = 0; (ret == 0) && (idx < list.count); idx++) {
+                idlmap = include_list_map(&list, idx, &idlmapsize);
+                if (idlmap == NULL) {
+                        ret = -1;
+                        break;
+                }
+                ret = cache_key_add(&keytext, &keylen, &keyalloc,
+                                    list.namev[idx],
+                                    idlmap, idlmapsize);
+                genb_funmap(idlmap, idlmapsize);
+        }
+
+        include_list_free(&list);
+
+        if (ret != 0) {
+                free(keytext);
+                return ret;
+        }
+
+        *key_out = keytext;
+        *keylen_out = keylen;
+
+        return 0;
+}
+
+/* exported interface defined in webidl-ast.h */
+int webidl_cache_save(const char *filename,
+                      const char *key,
+                      size_t keylen,
+                      struct webidl_node *webidl_ast)
+{
+        static const char pad[4] = { 0, 0, 0, 0 };
+        struct webidl_cache_ctx cctx;
+        struct webidl_cache_header header;
+        char *tmpname;
+        int tmpnamelen;
+        FILE *cachef;
+        int ret;
+
+        memset(&cctx, 0, sizeof(cctx));
+
+        ret = webidl_cache_node(&cctx, webidl_ast, &header.root);
+        if (ret == 0) {
+                header.magic = WEBIDL_CACHE_MAGIC;
+                header.version = WEBIDL_CACHE_VERSION;
+                header.keysize = keylen;
+                header.nodec = cctx.nodec;
+                header.strsize = cctx.strsize;
+
+                /* write a temporary file and rename it into place so
+                 * concurrent runs never see a partial cache
+                 */
+                tmpnamelen = strlen(filename) + 16;
+                tmpname = malloc(tmpnamelen);
+                snprintf(tmpname, tmpnamelen, "%s.%d", filename, (int)getpid());
+
+                cachef = fopen(tmpname, "wb");
+                if (cachef == NULL) {
+                        ret = -1;
+                } else {
+                        if ((fwrite(&header, sizeof(header), 1, cachef) != 1) ||
+                            (fwrite(key, 1, keylen, cachef) != keylen) ||
+                            (fwrite(pad, 1, (-keylen) & 3, cachef) !=
+                             ((-keylen) & 3)) ||
+                            (fwrite(cctx.nodev,
+                                    sizeof(struct webidl_cache_node),
+                                    cctx.nodec,
+                                    cachef) != cctx.nodec) ||
+                            (fwrite(cctx.str, 1, cctx.strsize, cachef) !=
+                             cctx.strsize)) {
+                                ret = -1;
+                        }
+                        if (fclose(cachef) != 0) {
+                                ret = -1;
+                        }
+                        if ((ret == 0) && (rename(tmpname, filename) != 0)) {
+                                ret = -1;
+                        }
+                        if (ret != 0) {
+                                unlink(tmpname);
+                        }
+                }
+                free(tmpname);
+        }
+
+        free(cctx.nodemap.keyv);
+        free(cctx.nodemap.valuev);
+        free(cctx.strmap.keyv);
+        free(cctx.strmap.valuev);
+        free(cctx.nodev);
+        free(cctx.str);
+
+        if (ret != 0) {
+                fprintf(stderr, "Error writing IDL cache %s\n", filename);
+        }
+        return ret;
+}
+
+/**
+ * position of a cached node in the loaded node array
+ *
+ * The root node is swapped with the first so the loaded AST is the
+ *  start of its allocation.
+ *
+ * \param idx The index of the node in the cache.
+ * \param root The index of the root node in the cache.
+ */
+static uint32_t webidl_cache_node_pos(uint32_t idx, uint32_t root)
+{
+        if (idx == root) {
+                return 0;
+        }
+        if (idx == 0) {
+                return root;
+        }
+        return idx;
+}
+
+/* exported interface defined in webidl-ast.h */
+int webidl_cache_load(const char *filename,
+                      const char *key,
+                      size_t keylen,
+                      struct webidl_node **webidl_ast)
+{
+        FILE *cachef;
+        char *map;
+        size_t mapsize;
+        size_t datasize;
+        size_t keysize;
+        struct webidl_cache_header *header;
+        struct webidl_cache_node *cnodev;
+        struct webidl_node *nodev;
+        uint32_t *fltv;
+        char *str;
+        uint32_t root;
+        uint32_t idx;
+
+        cachef = fopen(filename, "rb");
+        if (cachef == NULL) {
+                return -1;
+        }
+
+        map = genb_fmap(cachef, &mapsize);
+        if (map == NULL) {
+                return -1;
+        }
+        datasize = mapsize - 2;
+
+        /* the manifest of the sources must match exactly */
+        keysize = (keylen + 3) & ~(size_t)3;
+        header = (struct webidl_cache_header *)map;
+        if ((datasize < (sizeof(*header) + keysize)) ||
+            (header->magic != WEBIDL_CACHE_MAGIC) ||
+            (header->version != WEBIDL_CACHE_VERSION) ||
+            (header->keysize != keylen) ||
+            (memcmp(map + sizeof(*header), key, keylen) != 0) ||
+            (header->root > header->nodec) ||
+            (datasize != (sizeof(*header) + keysize +
+                          (header->nodec * sizeof(struct webidl_cache_node)) +
+                          header->strsize)) ||
+            ((header->strsize > 0) && (map[datasize - 1] != 0))) {
+                /* not a usable cache */
+                genb_funmap(map, mapsize);
+                return -1;
+        }
+
+        if (header->root == 0) {
+                /* an empty AST */
+                genb_funmap(map, mapsize);
+                *webidl_ast = NULL;
+                return 0;
+        }
+        root = header->root - 1;
+
+        /* the nodes, float values and strings are a single allocation */
+        nodev = calloc(1, (header->nodec * (sizeof(struct webidl_node) +
+                                            sizeof(uint32_t))) +
+                       header->strsize + 1);
+        if (nodev == NULL) {
+                genb_funmap(map, mapsize);
+                return -1;
+        }
+        fltv = (uint32_t *)(nodev + header->nodec);
+        str = (char *)(fltv + header->nodec);
+
+        cnodev = (struct webidl_cache_node *)(map + sizeof(*header) + keysize);
+        memcpy(str,
+               map + sizeof(*header) + keysize +
+               (header->nodec * sizeof(struct webidl_cache_node)),
+               header->strsize);
+
+        for (idx = 0; idx < header->nodec; idx++) {
+                struct webidl_cache_node *cnode = &cnodev[idx];
+                struct webidl_node *node;
+
+                node = &nodev[webidl_cache_node_pos(idx, root)];
+                if (cnode->l > header->nodec) {
+                        break;
+                }
+                node->type = cnode->type;
+                node->l = (cnode->l == 0) ? NULL :
+                        &nodev[webidl_cache_node_pos(cnode->l - 1, root)];
+                stats_node(STATS_AST_WEBIDL, node->type, 1,
+                           sizeof(struct webidl_node));
+
+                switch (webidl_cache_value_type(cnode->type)) {
+                case WEBIDL_CACHE_VALUE_NODE:
+                        if (cnode->r > header->nodec) {
+                                break;
+                        }
+                        if (cnode->r != 0) {
+                                node->r.node = &nodev[webidl_cache_node_pos(
+                                                cnode->r - 1, root)];
+                        }
+                        continue;
+
+                case WEBIDL_CACHE_VALUE_TEXT:
+                        if (cnode->r > header->strsize) {
+                                break;
+                        }
+                        if (cnode->r != 0) {
+                                node->r.text = str + cnode->r - 1;
+                        }
+                        continue;
+
+                case WEBIDL_CACHE_VALUE_NUMBER:
+                        node->r.number = (int)cnode->r;
+                        continue;
+
+                case WEBIDL_CACHE_VALUE_FLOAT:
+                        fltv[idx] = cnode->r;
+                        node->r.flt = (float *)&fltv[idx];
+                        continue;
+
+                case WEBIDL_CACHE_VALUE_NONE:
+                        continue;
+                }
+                /* reference out of range */
+                break;
+        }
+
+        if (idx != header->nodec) {
+                genb_funmap(map, mapsize);
+                free(nodev);
+                return -1;
+        }
+
+        genb_funmap(map, mapsize);
+
+        *webidl_ast = nodev;
+
+        return 0;
+}
+
+/* exported interface defined in webidl-ast.h */
+void webidl_cache_free(struct webidl_node *webidl_ast)
+{
+        free(webidl_ast);
+}
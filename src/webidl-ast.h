@@ -9,6 +9,8 @@
 #ifndef nsgenbind_webidl_ast_h
 #define nsgenbind_webidl_ast_h
 
+#include <stdint.h>
+
 enum webidl_node_type {
 	/* generic node types which define structure or attributes */
 	WEBIDL_NODE_TYPE_ROOT = 0,
@@ -108,6 +110,13 @@ struct webidl_node *webidl_node_append(struct webidl_node *list, struct webidl_n
 
 struct webidl_node *webidl_node_add(struct webidl_node *node, struct webidl_node *list);
 
+/**
+ * unlink a child node from a parent
+ *
+ * \return 0 on success or -1 if the node is not a child of the parent.
+ */
+int webidl_unlink(struct webidl_node *parent, struct webidl_node *node);
+
 /* node contents acessors */
 char *webidl_node_gettext(struct webidl_node *node);
 struct webidl_node *webidl_node_getnode(struct webidl_node *node);
@@ -148,17 +157,211 @@ webidl_node_find_type_ident(struct webidl_node *root_node,
 			    enum webidl_node_type type, 
 			    const char *ident);
 
+/* definition index */
+
+/**
+ * Index of top level definitions by type and identifier
+ */
+struct webidl_index;
+
+/**
+ * create a definition index
+ *
+ * Where a name is defined more than once the definition nearest the
+ *  head of the list is indexed.
+ *
+ * \param webidl_ast AST of existing definitions to index, may be NULL.
+ * \return new index or NULL on allocation error.
+ */
+struct webidl_index *webidl_index_new(struct webidl_node *webidl_ast);
+
+/**
+ * free a definition index, the indexed nodes are unaffected.
+ */
+void webidl_index_free(struct webidl_index *index);
+
+/**
+ * add a definition to an index
+ *
+ * A definition replaces any with the same type and identifier so nodes
+ *  prepended to an indexed list should be added.
+ *
+ * \param index The index to add to.
+ * \param ident The identifier of the definition.
+ * \param node The interface or dictionary node of the definition.
+ * \return 0 on success else -1 on allocation error.
+ */
+int webidl_index_add(struct webidl_index *index,
+                     const char *ident,
+                     struct webidl_node *node);
+
+/**
+ * find a definition in an index
+ *
+ * \param index The index to search.
+ * \param type The type of definition.
+ * \param ident The identifier of the definition.
+ * \return The definition node or NULL if not found.
+ */
+struct webidl_node *
+webidl_index_find(struct webidl_index *index,
+                  enum webidl_node_type type,
+                  const char *ident);
+
+
 
+/**
+ * get the path a web idl file is read from
+ *
+ * \param filename The name of the file.
+ * \return The path which the caller must free or NULL on error.
+ */
+char *webidl_filepath(const char *filename);
 
 /**
  * parse web idl file into Abstract Syntax Tree
+ *
+ * \param filename The name of the file on the IDL path.
+ * \param outdirname The directory debug output is written to.
+ * \param webidl_ast Updated with the AST.
+ * \return 0 on success or non zero on error.
+ */
+int webidl_parsefile(char *filename, const char *outdirname, struct webidl_node **webidl_ast);
+
+/**
+ * parse several web idl files
+ *
+ * Each file is parsed into its own AST, concurrently unless debugging.
+ *
+ * \param outdirname The directory debug output is written to.
+ * \param filec The number of files.
+ * \param filenamev The names of the files to parse.
+ * \param astv Array updated with the AST of each file.
+ * \return 0 on success or the error from the first failing file.
  */
-int webidl_parsefile(char *filename, struct webidl_node **webidl_ast);
+int webidl_parsefiles(const char *outdirname,
+                      int filec,
+                      char **filenamev,
+                      struct webidl_node **astv);
+
+/**
+ * merge the ASTs of several web idl files
+ *
+ * The files are merged in order combining partial definitions. The
+ * file ASTs are not altered so they may be merged more than once.
+ *
+ * \param filec The number of file ASTs.
+ * \param astv The file ASTs.
+ * \param webidl_ast The AST to merge the definitions into.
+ * \return 0 on success or -1 on error.
+ */
+int webidl_merge(int filec,
+                 struct webidl_node **astv,
+                 struct webidl_node **webidl_ast);
+
+/**
+ * free an AST made by merging file ASTs
+ *
+ * Only the nodes the merge created are freed, the file ASTs are
+ * unaffected.
+ *
+ * \param webidl_ast The merged AST.
+ */
+void webidl_merge_free(struct webidl_node *webidl_ast);
+
+/**
+ * free the AST parsed from a web idl file
+ *
+ * All node text, including literals and keywords, is interned by the
+ * scanner and parser so only the nodes and float values are freed.
+ *
+ * \param webidl_ast The file AST.
+ */
+void webidl_ast_free(struct webidl_node *webidl_ast);
+
+/**
+ * list the files a web idl file includes
+ *
+ * Follows the #include directives of the file and of every file it
+ * includes. Names are as given in the directives which are opened
+ * relative to the working directory.
+ *
+ * \param filename The name of the file on the IDL path.
+ * \param includec_out Updated with the number of included files.
+ * \param includev_out Updated with the included file names, the caller
+ *                     frees each name and the vector.
+ * \return 0 on success or -1 on error.
+ */
+int webidl_includes(const char *filename, int *includec_out, char ***includev_out);
+
+/**
+ * compute the IDL cache key for a set of web idl files
+ *
+ * The key is a manifest of the path, length and 64 bit content hash
+ *  of the files and of every file they include. It is stored in the
+ *  cache and compared in full when the cache is loaded.
+ *
+ * \param filec The number of files.
+ * \param filenamev The names of the files.
+ * \param key_out Updated with the key which the caller must free.
+ * \param keylen_out Updated with the length of the key.
+ * \return 0 on success or -1 if a file could not be read.
+ */
+int webidl_cache_key(int filec,
+                     char **filenamev,
+                     char **key_out,
+                     size_t *keylen_out);
+
+/**
+ * load an AST from an IDL cache
+ *
+ * The cache file is mapped and the AST constructed without parsing.
+ * The AST is freed with webidl_cache_free().
+ *
+ * \param filename The cache file name.
+ * \param key The key the cache must have been saved with.
+ * \param keylen The length of the key.
+ * \param webidl_ast Updated with the loaded AST.
+ * \return 0 on success or -1 if the cache is missing, stale or invalid.
+ */
+int webidl_cache_load(const char *filename,
+                      const char *key,
+                      size_t keylen,
+                      struct webidl_node **webidl_ast);
+
+/**
+ * free an AST loaded from an IDL cache
+ *
+ * \param webidl_ast The loaded AST.
+ */
+void webidl_cache_free(struct webidl_node *webidl_ast);
+
+/**
+ * save an AST to an IDL cache
+ *
+ * \param filename The cache file name.
+ * \param key The key of the files the AST was parsed from.
+ * \param keylen The length of the key.
+ * \param webidl_ast The AST to save.
+ * \return 0 on success or -1 on error.
+ */
+int webidl_cache_save(const char *filename,
+                      const char *key,
+                      size_t keylen,
+                      struct webidl_node *webidl_ast);
 
 /**
  * dump AST to file
+ *
+ * \param outdirname The directory to write the dump to.
+ * \param node The AST to dump.
+ */
+int webidl_dump_ast(const char *outdirname, struct webidl_node *node);
+
+/**
+ * get the name of a node type
  */
-int webidl_dump_ast(struct webidl_node *node);
+const char *webidl_node_type_to_str(enum webidl_node_type type);
 
 /**
  * perform replacement of implements elements with copies of ast data
@@ -32,24 +32,36 @@
 
 #include "webidl-ast.h"
 
-static char *errtxt;
-
 static void
-webidl_error(YYLTYPE *locp, struct webidl_node **winbind_ast, const char *str)
+webidl_error(YYLTYPE *locp,
+             void *scanner,
+             struct webidl_index *index,
+             struct webidl_node **winbind_ast,
+             const char *str)
 {
-    UNUSED(locp);
+    UNUSED(index);
     UNUSED(winbind_ast);
-    errtxt = strdup(str);
+    /* reported immediately as files may be parsed concurrently */
+    fprintf(stderr, "%s:%d: %s\n",
+            webidl_get_extra(scanner), locp->first_line, str);
 }
 
 %}
 
+%code requires {
+/* the definition index is opaque to the parser */
+struct webidl_index;
+}
+
 %locations
  /* bison prior to 2.4 cannot cope with %define api.pure so we use the
   *  deprecated directive 
   */
 %pure-parser
 %error-verbose
+%lex-param { void *scanner }
+%parse-param { void *scanner }
+%parse-param { struct webidl_index *index }
 %parse-param { struct webidl_node **webidl_ast }
 
 %union
@@ -233,14 +245,15 @@ Definitions:
         |
         Definitions ExtendedAttributeList Definition
         {
-            webidl_node_add($3, $2);
+            if (webidl_node_add($3, $2) != $3) {
+                    /* definition was dropped or cannot hold attributes */
+                    webidl_ast_free($2);
+            }
             $$ = *webidl_ast = webidl_node_prepend(*webidl_ast, $3);
         }
         |
         error
         {
-            fprintf(stderr, "%d: %s\n", yylloc.first_line, errtxt);
-            free(errtxt);
             YYABORT ;
         }
         ;
@@ -297,9 +310,9 @@ Interface:
                 members = webidl_node_new(WEBIDL_NODE_TYPE_LIST, members, $5);
 
 
-                interface_node = webidl_node_find_type_ident(*webidl_ast,
-                                                     WEBIDL_NODE_TYPE_INTERFACE,
-                                                             $2);
+                interface_node = webidl_index_find(index,
+                                                   WEBIDL_NODE_TYPE_INTERFACE,
+                                                   $2);
 
                 if (interface_node == NULL) {
                         /* no existing interface - create one with ident */
@@ -310,6 +323,12 @@ Interface:
                         $$ = webidl_node_new(WEBIDL_NODE_TYPE_INTERFACE,
                                              NULL,
                                              members);
+                        if (webidl_index_add(index, $2, $$) != 0) {
+                                webidl_error(&@2, scanner, index, webidl_ast,
+                                             "out of memory");
+                                webidl_ast_free($$);
+                                YYABORT;
+                        }
                 } else {
                         /* update the existing interface */
 
@@ -344,9 +363,9 @@ PartialInterface:
             struct webidl_node *members;
             struct webidl_node *interface_node;
 
-            interface_node = webidl_node_find_type_ident(*webidl_ast,
-                                                     WEBIDL_NODE_TYPE_INTERFACE,
-                                                     $2);
+            interface_node = webidl_index_find(index,
+                                               WEBIDL_NODE_TYPE_INTERFACE,
+                                               $2);
 
             members = webidl_node_new(WEBIDL_NODE_TYPE_LIST, NULL, $4);
 
@@ -356,6 +375,12 @@ PartialInterface:
                 members = webidl_node_new(WEBIDL_NODE_TYPE_IDENT, members, $2);
 
                 $$ = webidl_node_new(WEBIDL_NODE_TYPE_INTERFACE, NULL, members);
+                if (webidl_index_add(index, $2, $$) != 0) {
+                        webidl_error(&@2, scanner, index, webidl_ast,
+                                     "out of memory");
+                        webidl_ast_free($$);
+                        YYABORT;
+                }
             } else {
                 /* update the existing interface */
 
@@ -398,6 +423,7 @@ InterfaceMembers:
                 if (ident_node == NULL) {
                         /* something with no ident - possibly constructors? */
                         /* @todo understand this better */
+                        webidl_ast_free($2);
 
                         $$ = webidl_node_prepend($1, $3);
 
@@ -407,7 +433,9 @@ InterfaceMembers:
                          */
 
                         /* add extended attributes to parameter list */
-                        webidl_node_add($3, $2);
+                        if (webidl_node_add($3, $2) != $3) {
+                                webidl_ast_free($2);
+                        }
 
                         $$ = webidl_node_prepend($1, $3);
 
@@ -424,6 +452,9 @@ InterfaceMembers:
                                 /* not a member with that ident already present */
                                 $$ = webidl_node_prepend($1, $3);
                         } else {
+                                /* only the argument list is kept */
+                                webidl_unlink($3, list_node);
+                                webidl_ast_free($3);
                                 webidl_node_add(member_node, list_node);
                                 $$ = $1; /* updated existing node do not add new one */
                         }
@@ -462,10 +493,9 @@ Dictionary:
 
                 members = webidl_node_new(WEBIDL_NODE_TYPE_LIST, members, $5);
 
-                dictionary_node = webidl_node_find_type_ident(
-                                         *webidl_ast,
-                                         WEBIDL_NODE_TYPE_DICTIONARY,
-                                         $2);
+                dictionary_node = webidl_index_find(index,
+                                                    WEBIDL_NODE_TYPE_DICTIONARY,
+                                                    $2);
 
                 if (dictionary_node == NULL) {
                         /* no existing interface - create one with ident */
@@ -476,6 +506,12 @@ Dictionary:
                         $$ = webidl_node_new(WEBIDL_NODE_TYPE_DICTIONARY,
                                              NULL,
                                              members);
+                        if (webidl_index_add(index, $2, $$) != 0) {
+                                webidl_error(&@2, scanner, index, webidl_ast,
+                                             "out of memory");
+                                webidl_ast_free($$);
+                                YYABORT;
+                        }
                 } else {
                         /* update the existing interface */
 
@@ -496,6 +532,7 @@ DictionaryMembers:
         ExtendedAttributeList DictionaryMember DictionaryMembers
         {
                 /** \todo handle ExtendedAttributeList */
+                webidl_ast_free($1);
                 $$ = webidl_node_append($3, $2);
         }
         ;
@@ -551,10 +588,9 @@ PartialDictionary:
                 struct webidl_node *members;
                 struct webidl_node *dictionary_node;
 
-                dictionary_node = webidl_node_find_type_ident(
-                                         *webidl_ast,
-                                         WEBIDL_NODE_TYPE_DICTIONARY,
-                                         $2);
+                dictionary_node = webidl_index_find(index,
+                                                    WEBIDL_NODE_TYPE_DICTIONARY,
+                                                    $2);
 
                 members = webidl_node_new(WEBIDL_NODE_TYPE_LIST, NULL, $4);
 
@@ -568,6 +604,12 @@ PartialDictionary:
                         $$ = webidl_node_new(WEBIDL_NODE_TYPE_DICTIONARY,
                                              NULL,
                                              members);
+                        if (webidl_index_add(index, $2, $$) != 0) {
+                                webidl_error(&@2, scanner, index, webidl_ast,
+                                             "out of memory");
+                                webidl_ast_free($$);
+                                YYABORT;
+                        }
                 } else {
                         /* update the existing dictionary */
 
@@ -665,6 +707,8 @@ EnumValueListString:
 CallbackRest:
         TOK_IDENTIFIER '=' ReturnType '(' ArgumentList ')' ';'
         {
+                webidl_ast_free($3);
+                webidl_ast_free($5);
                 $$ = NULL;
         }
         ;
@@ -673,6 +717,8 @@ CallbackRest:
 Typedef:
         TOK_TYPEDEF ExtendedAttributeList Type TOK_IDENTIFIER ';'
         {
+                webidl_ast_free($2);
+                webidl_ast_free($3);
                 $$ = NULL;
         }
         ;
@@ -686,9 +732,9 @@ ImplementsStatement:
             struct webidl_node *interface_node;
 
 
-            interface_node = webidl_node_find_type_ident(*webidl_ast,
-                                                     WEBIDL_NODE_TYPE_INTERFACE,
-                                                     $1);
+            interface_node = webidl_index_find(index,
+                                               WEBIDL_NODE_TYPE_INTERFACE,
+                                               $1);
 
             implements = webidl_node_new(WEBIDL_NODE_TYPE_INTERFACE_IMPLEMENTS, NULL, $3);
 
@@ -698,6 +744,12 @@ ImplementsStatement:
                 implements = webidl_node_new(WEBIDL_NODE_TYPE_IDENT, implements, $1);
 
                 $$ = webidl_node_new(WEBIDL_NODE_TYPE_INTERFACE, NULL, implements);
+                if (webidl_index_add(index, $1, $$) != 0) {
+                        webidl_error(&@1, scanner, index, webidl_ast,
+                                     "out of memory");
+                        webidl_ast_free($$);
+                        YYABORT;
+                }
             } else {
                 /* update the existing interface */
 
@@ -937,7 +989,7 @@ AttributeName:
 AttributeNameKeyword:
         TOK_REQUIRED
         {
-                $$ = strdup("required");
+                $$ = genb_intern("required", SLEN("required"));
         }
 
 /* [33]
@@ -1115,6 +1167,7 @@ Arguments:
 Argument:
         ExtendedAttributeList OptionalOrRequiredArgument
         {
+                webidl_ast_free($1);
                 $$ = $2;
         }
         ;
@@ -1164,11 +1217,14 @@ Ellipsis:
 Iterable:
         TOK_ITERABLE '<' Type OptionalType '>' ';'
         {
+                webidl_ast_free($3);
+                webidl_ast_free($4);
                 $$ = NULL;
         }
         |
         TOK_LEGACYITERABLE '<' Type '>' ';'
         {
+                webidl_ast_free($3);
                 $$ = NULL;
         }
         ;
@@ -1182,7 +1238,7 @@ OptionalType:
         |
         ',' Type
         {
-                $$ = NULL;
+                $$ = $2;
         }
         ;
 
@@ -1254,7 +1310,7 @@ ExtendedAttribute:
                 /* Constructor */
                 $$ = webidl_node_new(WEBIDL_NODE_TYPE_IDENT,
                                      NULL,
-                                     strdup("Constructor"));
+                                     genb_intern("Constructor", SLEN("Constructor")));
         }
         |
         TOK_CONSTRUCTOR '(' ArgumentList ')'
@@ -1263,7 +1319,7 @@ ExtendedAttribute:
                 $$ = webidl_node_new(WEBIDL_NODE_TYPE_OPERATION,
                                      webidl_node_new(WEBIDL_NODE_TYPE_IDENT,
                                                      NULL,
-                                                     strdup("Constructor")),
+                                                     genb_intern("Constructor", SLEN("Constructor"))),
                                      webidl_node_new(WEBIDL_NODE_TYPE_LIST,
                                                      NULL,
                                                      $3));
@@ -1275,7 +1331,7 @@ ExtendedAttribute:
                 $$ = webidl_node_new(WEBIDL_NODE_TYPE_OPERATION,
                                      webidl_node_new(WEBIDL_NODE_TYPE_IDENT,
                                                      NULL,
-                                                     strdup("NamedConstructor")),
+                                                     genb_intern("NamedConstructor", SLEN("NamedConstructor"))),
                                      webidl_node_new(WEBIDL_NODE_TYPE_LIST,
                                                      webidl_node_new(WEBIDL_NODE_TYPE_IDENT,
                                                                      NULL,
@@ -1381,152 +1437,152 @@ Other:
         |
         '-'
         {
-                $$ = strdup("-");
+                $$ = genb_intern("-", SLEN("-"));
         }
         |
         '.'
         {
-                $$ = strdup(".");
+                $$ = genb_intern(".", SLEN("."));
         }
         |
         TOK_ELLIPSIS
         {
-                $$ = strdup("...");
+                $$ = genb_intern("...", SLEN("..."));
         }
         |
         ':'
         {
-                $$ = strdup(":");
+                $$ = genb_intern(":", SLEN(":"));
         }
         |
         ';'
         {
-                $$ = strdup(";");
+                $$ = genb_intern(";", SLEN(";"));
         }
         |
         '<'
         {
-                $$ = strdup("<");
+                $$ = genb_intern("<", SLEN("<"));
         }
         |
         '='
         {
-                $$ = strdup("=");
+                $$ = genb_intern("=", SLEN("="));
         }
         |
         '>'
         {
-                $$ = strdup(">");
+                $$ = genb_intern(">", SLEN(">"));
         }
         |
         '?'
         {
-                $$ = strdup("?");
+                $$ = genb_intern("?", SLEN("?"));
         }
         |
         TOK_DATE
         {
-                $$ = strdup("Date");
+                $$ = genb_intern("Date", SLEN("Date"));
         }
         |
         TOK_STRING
         {
-                $$ = strdup("DOMString");
+                $$ = genb_intern("DOMString", SLEN("DOMString"));
         }
         |
         TOK_INFINITY
         {
-                $$ = strdup("Infinity");
+                $$ = genb_intern("Infinity", SLEN("Infinity"));
         }
         |
         TOK_NAN
         {
-                $$ = strdup("NaN");
+                $$ = genb_intern("NaN", SLEN("NaN"));
         }
         |
         TOK_ANY
         {
-                $$ = strdup("any");
+                $$ = genb_intern("any", SLEN("any"));
         }
         |
         TOK_BOOLEAN
         {
-                $$ = strdup("boolean");
+                $$ = genb_intern("boolean", SLEN("boolean"));
         }
         |
         TOK_BYTE
         {
-                $$ = strdup("byte");
+                $$ = genb_intern("byte", SLEN("byte"));
         }
         |
         TOK_DOUBLE
         {
-                $$ = strdup("double");
+                $$ = genb_intern("double", SLEN("double"));
         }
         |
         TOK_FALSE
         {
-                $$ = strdup("false");
+                $$ = genb_intern("false", SLEN("false"));
         }
         |
         TOK_FLOAT
         {
-            $$ = strdup("float");
+            $$ = genb_intern("float", SLEN("float"));
         }
         |
         TOK_LONG
         {
-            $$ = strdup("long");
+            $$ = genb_intern("long", SLEN("long"));
         }
         |
         TOK_NULL_LITERAL
         {
-            $$ = strdup("null");
+            $$ = genb_intern("null", SLEN("null"));
         }
         |
         TOK_OBJECT
         {
-            $$ = strdup("object");
+            $$ = genb_intern("object", SLEN("object"));
         }
         |
         TOK_OCTET
         {
-            $$ = strdup("octet");
+            $$ = genb_intern("octet", SLEN("octet"));
         }
         |
         TOK_OR
         {
-            $$ = strdup("or");
+            $$ = genb_intern("or", SLEN("or"));
         }
         |
         TOK_OPTIONAL
         {
-            $$ = strdup("optional");
+            $$ = genb_intern("optional", SLEN("optional"));
         }
         |
         TOK_SEQUENCE
         {
-            $$ = strdup("sequence");
+            $$ = genb_intern("sequence", SLEN("sequence"));
         }
         |
         TOK_SHORT
         {
-            $$ = strdup("short");
+            $$ = genb_intern("short", SLEN("short"));
         }
         |
         TOK_TRUE
         {
-            $$ = strdup("true");
+            $$ = genb_intern("true", SLEN("true"));
         }
         |
         TOK_UNSIGNED
         {
-            $$ = strdup("unsigned");
+            $$ = genb_intern("unsigned", SLEN("unsigned"));
         }
         |
         TOK_VOID
         {
-            $$ = strdup("void");
+            $$ = genb_intern("void", SLEN("void"));
         }
         |
         ArgumentNameKeyword
@@ -1541,112 +1597,112 @@ Other:
 ArgumentNameKeyword:
         TOK_ATTRIBUTE
         {
-            $$ = strdup("attribute");
+            $$ = genb_intern("attribute", SLEN("attribute"));
         }
         |
         TOK_CALLBACK
         {
-            $$ = strdup("callback");
+            $$ = genb_intern("callback", SLEN("callback"));
         }
         |
         TOK_CONST
         {
-            $$ = strdup("const");
+            $$ = genb_intern("const", SLEN("const"));
         }
         |
         TOK_CREATOR
         {
-            $$ = strdup("creator");
+            $$ = genb_intern("creator", SLEN("creator"));
         }
         |
         TOK_DELETER
         {
-            $$ = strdup("deleter");
+            $$ = genb_intern("deleter", SLEN("deleter"));
         }
         |
         TOK_DICTIONARY
         {
-            $$ = strdup("dictionary");
+            $$ = genb_intern("dictionary", SLEN("dictionary"));
         }
         |
         TOK_ENUM
         {
-            $$ = strdup("enum");
+            $$ = genb_intern("enum", SLEN("enum"));
         }
         |
         TOK_EXCEPTION
         {
-            $$ = strdup("exception");
+            $$ = genb_intern("exception", SLEN("exception"));
         }
         |
         TOK_GETTER
         {
-            $$ = strdup("getter");
+            $$ = genb_intern("getter", SLEN("getter"));
         }
         |
         TOK_IMPLEMENTS
         {
-            $$ = strdup("implements");
+            $$ = genb_intern("implements", SLEN("implements"));
         }
         |
         TOK_INHERIT
         {
-            $$ = strdup("inherit");
+            $$ = genb_intern("inherit", SLEN("inherit"));
         }
         |
         TOK_INTERFACE
         {
-            $$ = strdup("interface");
+            $$ = genb_intern("interface", SLEN("interface"));
         }
         |
         TOK_ITERABLE
         {
-            $$ = strdup("iterable");
+            $$ = genb_intern("iterable", SLEN("iterable"));
         }
         |
         TOK_LEGACYCALLER
         {
-            $$ = strdup("legacycaller");
+            $$ = genb_intern("legacycaller", SLEN("legacycaller"));
         }
         |
         TOK_LEGACYITERABLE
         {
-            $$ = strdup("legacyiterable");
+            $$ = genb_intern("legacyiterable", SLEN("legacyiterable"));
         }
         |
         TOK_PARTIAL
         {
-            $$ = strdup("partial");
+            $$ = genb_intern("partial", SLEN("partial"));
         }
         |
         TOK_REQUIRED
         {
-            $$ = strdup("required");
+            $$ = genb_intern("required", SLEN("required"));
         }
         |
         TOK_SETTER
         {
-            $$ = strdup("setter");
+            $$ = genb_intern("setter", SLEN("setter"));
         }
         |
         TOK_STATIC
         {
-            $$ = strdup("static");
+            $$ = genb_intern("static", SLEN("static"));
         }
         |
         TOK_STRINGIFIER
         {
-            $$ = strdup("stringifier");
+            $$ = genb_intern("stringifier", SLEN("stringifier"));
         }
         |
         TOK_TYPEDEF
         {
-            $$ = strdup("typedef");
+            $$ = genb_intern("typedef", SLEN("typedef"));
         }
         |
         TOK_UNRESTRICTED
         {
-            $$ = strdup("unrestricted");
+            $$ = genb_intern("unrestricted", SLEN("unrestricted"));
         }
         ;
 
@@ -1659,7 +1715,7 @@ OtherOrComma:
         |
         ','
         {
-            $$ = strdup(",");
+            $$ = genb_intern(",", SLEN(","));
         }
         ;
 
@@ -1673,6 +1729,7 @@ Type:
         UnionType TypeSuffix
         {
             /* todo handle suffix */
+            webidl_ast_free($2);
             $$ = $1;
         }
         ;
@@ -1684,6 +1741,7 @@ SingleType:
         TOK_ANY TypeSuffixStartingWithArray
         {
                 /* todo deal with TypeSuffixStartingWithArray */
+                webidl_ast_free($2);
                 $$ = webidl_new_number_node(WEBIDL_NODE_TYPE_TYPE_BASE,
                                             NULL,
                                             WEBIDL_TYPE_ANY);
@@ -1708,11 +1766,13 @@ UnionMemberType:
         UnionType TypeSuffix
         {
             /* todo handle suffix */
+            webidl_ast_free($2);
             $$ = $1;
         }
         |
         TOK_ANY '[' ']' TypeSuffix
         {
+                webidl_ast_free($4);
                 $$ = NULL;
         }
         ;
@@ -1912,6 +1972,7 @@ OptionalLong:
 PromiseType:
         TOK_PROMISE '<' ReturnType '>'
         {
+            webidl_ast_free($3);
             $$ = NULL;
         }
         ;
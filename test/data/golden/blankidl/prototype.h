@@ -0,0 +1,12 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_prototype_h
+#define dukky_prototype_h
+
+
+#endif
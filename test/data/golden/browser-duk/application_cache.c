@@ -0,0 +1,673 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+static void dukky_application_cache___init(duk_context *ctx, application_cache_private_t *priv)
+{
+	dukky_event_target___init(ctx, &priv->parent);
+	NSLOG(dukky, INFO, "Initialise %p (priv=%p)", duk_get_heapptr(ctx, 0), priv);
+}
+
+static void dukky_application_cache___fini(duk_context *ctx, application_cache_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Finalise %p", duk_get_heapptr(ctx, 0));
+	dukky_event_target___fini(ctx, &priv->parent);
+}
+
+static duk_ret_t dukky_application_cache___constructor(duk_context *ctx)
+{
+	/* create private data and attach to instance */
+	application_cache_private_t *priv = calloc(1, sizeof(*priv));
+	if (priv == NULL) return 0;
+	duk_push_pointer(ctx, priv);
+	duk_put_prop_string(ctx, 0, dukky_magic_string_private);
+
+	dukky_application_cache___init(ctx, priv);
+	duk_set_top(ctx, 1);
+	return 1;
+}
+
+static duk_ret_t dukky_application_cache___destructor(duk_context *ctx)
+{
+	application_cache_private_t *priv;
+	duk_get_prop_string(ctx, 0, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+	if (priv == NULL) return 0;
+
+	dukky_application_cache___fini(ctx, priv);
+	free(priv);
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_update(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_abort(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_swapCache(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_status_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onchecking_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onchecking_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onerror_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onerror_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onnoupdate_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onnoupdate_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_ondownloading_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_ondownloading_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onprogress_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onprogress_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onupdateready_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onupdateready_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_oncached_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_oncached_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onobsolete_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_application_cache_onobsolete_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	application_cache_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+duk_ret_t dukky_application_cache___proto(duk_context *ctx, void *udata)
+{
+	/* Set this prototype's prototype (left-parent) */
+	/* get prototype */
+	duk_get_global_string(ctx, dukky_magic_string_prototypes);
+	duk_get_prop_string(ctx, -1, "\xFF\xFFNETSURF_DUKTAPE_PROTOTYPE_EVENTTARGET");
+	duk_replace(ctx, -2);
+	duk_set_prototype(ctx, 0);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "update");
+	duk_push_c_function(ctx, dukky_application_cache_update, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "abort");
+	duk_push_c_function(ctx, dukky_application_cache_abort, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "swapCache");
+	duk_push_c_function(ctx, dukky_application_cache_swapCache, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "status");
+	duk_push_c_function(ctx, dukky_application_cache_status_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "onchecking");
+	duk_push_c_function(ctx, dukky_application_cache_onchecking_getter, 0);
+	duk_push_c_function(ctx, dukky_application_cache_onchecking_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "onerror");
+	duk_push_c_function(ctx, dukky_application_cache_onerror_getter, 0);
+	duk_push_c_function(ctx, dukky_application_cache_onerror_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "onnoupdate");
+	duk_push_c_function(ctx, dukky_application_cache_onnoupdate_getter, 0);
+	duk_push_c_function(ctx, dukky_application_cache_onnoupdate_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "ondownloading");
+	duk_push_c_function(ctx, dukky_application_cache_ondownloading_getter, 0);
+	duk_push_c_function(ctx, dukky_application_cache_ondownloading_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "onprogress");
+	duk_push_c_function(ctx, dukky_application_cache_onprogress_getter, 0);
+	duk_push_c_function(ctx, dukky_application_cache_onprogress_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "onupdateready");
+	duk_push_c_function(ctx, dukky_application_cache_onupdateready_getter, 0);
+	duk_push_c_function(ctx, dukky_application_cache_onupdateready_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "oncached");
+	duk_push_c_function(ctx, dukky_application_cache_oncached_getter, 0);
+	duk_push_c_function(ctx, dukky_application_cache_oncached_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "onobsolete");
+	duk_push_c_function(ctx, dukky_application_cache_onobsolete_getter, 0);
+	duk_push_c_function(ctx, dukky_application_cache_onobsolete_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "UNCACHED");
+	duk_push_int(ctx, 0);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "IDLE");
+	duk_push_int(ctx, 1);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "CHECKING");
+	duk_push_int(ctx, 2);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "DOWNLOADING");
+	duk_push_int(ctx, 3);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "UPDATEREADY");
+	duk_push_int(ctx, 4);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "OBSOLETE");
+	duk_push_int(ctx, 5);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Set the destructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_application_cache___destructor, 1);
+	duk_set_finalizer(ctx, -2);
+	duk_pop(ctx);
+
+	/* Set the constructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_application_cache___constructor, 1);
+	duk_put_prop_string(ctx, -2, "\xFF\xFFNETSURF_DUKTAPE_INIT");
+	duk_pop(ctx);
+
+	return 1; /* The prototype object */
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
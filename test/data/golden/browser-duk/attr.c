@@ -0,0 +1,398 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+static void dukky_attr___init(duk_context *ctx, attr_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Initialise %p (priv=%p)", duk_get_heapptr(ctx, 0), priv);
+}
+
+static void dukky_attr___fini(duk_context *ctx, attr_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Finalise %p", duk_get_heapptr(ctx, 0));
+}
+
+static duk_ret_t dukky_attr___constructor(duk_context *ctx)
+{
+	/* create private data and attach to instance */
+	attr_private_t *priv = calloc(1, sizeof(*priv));
+	if (priv == NULL) return 0;
+	duk_push_pointer(ctx, priv);
+	duk_put_prop_string(ctx, 0, dukky_magic_string_private);
+
+	dukky_attr___init(ctx, priv);
+	duk_set_top(ctx, 1);
+	return 1;
+}
+
+static duk_ret_t dukky_attr___destructor(duk_context *ctx)
+{
+	attr_private_t *priv;
+	duk_get_prop_string(ctx, 0, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+	if (priv == NULL) return 0;
+
+	dukky_attr___fini(ctx, priv);
+	free(priv);
+	return 0;
+}
+
+static duk_ret_t dukky_attr_namespaceURI_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_prefix_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_localName_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_name_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_value_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_value_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_nodeValue_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_nodeValue_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_textContent_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_textContent_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_ownerElement_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_attr_specified_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	attr_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+duk_ret_t dukky_attr___proto(duk_context *ctx, void *udata)
+{
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "namespaceURI");
+	duk_push_c_function(ctx, dukky_attr_namespaceURI_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "prefix");
+	duk_push_c_function(ctx, dukky_attr_prefix_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "localName");
+	duk_push_c_function(ctx, dukky_attr_localName_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "name");
+	duk_push_c_function(ctx, dukky_attr_name_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "value");
+	duk_push_c_function(ctx, dukky_attr_value_getter, 0);
+	duk_push_c_function(ctx, dukky_attr_value_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "nodeValue");
+	duk_push_c_function(ctx, dukky_attr_nodeValue_getter, 0);
+	duk_push_c_function(ctx, dukky_attr_nodeValue_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "textContent");
+	duk_push_c_function(ctx, dukky_attr_textContent_getter, 0);
+	duk_push_c_function(ctx, dukky_attr_textContent_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "ownerElement");
+	duk_push_c_function(ctx, dukky_attr_ownerElement_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "specified");
+	duk_push_c_function(ctx, dukky_attr_specified_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Set the destructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_attr___destructor, 1);
+	duk_set_finalizer(ctx, -2);
+	duk_pop(ctx);
+
+	/* Set the constructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_attr___constructor, 1);
+	duk_put_prop_string(ctx, -2, "\xFF\xFFNETSURF_DUKTAPE_INIT");
+	duk_pop(ctx);
+
+	return 1; /* The prototype object */
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
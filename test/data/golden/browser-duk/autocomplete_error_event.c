@@ -0,0 +1,118 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+static void dukky_autocomplete_error_event___init(duk_context *ctx, autocomplete_error_event_private_t *priv)
+{
+	dukky_event___init(ctx, &priv->parent);
+	NSLOG(dukky, INFO, "Initialise %p (priv=%p)", duk_get_heapptr(ctx, 0), priv);
+}
+
+static void dukky_autocomplete_error_event___fini(duk_context *ctx, autocomplete_error_event_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Finalise %p", duk_get_heapptr(ctx, 0));
+	dukky_event___fini(ctx, &priv->parent);
+}
+
+static duk_ret_t dukky_autocomplete_error_event___constructor(duk_context *ctx)
+{
+	/* create private data and attach to instance */
+	autocomplete_error_event_private_t *priv = calloc(1, sizeof(*priv));
+	if (priv == NULL) return 0;
+	duk_push_pointer(ctx, priv);
+	duk_put_prop_string(ctx, 0, dukky_magic_string_private);
+
+	dukky_autocomplete_error_event___init(ctx, priv);
+	duk_set_top(ctx, 1);
+	return 1;
+}
+
+static duk_ret_t dukky_autocomplete_error_event___destructor(duk_context *ctx)
+{
+	autocomplete_error_event_private_t *priv;
+	duk_get_prop_string(ctx, 0, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+	if (priv == NULL) return 0;
+
+	dukky_autocomplete_error_event___fini(ctx, priv);
+	free(priv);
+	return 0;
+}
+
+static duk_ret_t dukky_autocomplete_error_event_reason_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	autocomplete_error_event_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+duk_ret_t dukky_autocomplete_error_event___proto(duk_context *ctx, void *udata)
+{
+	/* Set this prototype's prototype (left-parent) */
+	/* get prototype */
+	duk_get_global_string(ctx, dukky_magic_string_prototypes);
+	duk_get_prop_string(ctx, -1, "\xFF\xFFNETSURF_DUKTAPE_PROTOTYPE_EVENT");
+	duk_replace(ctx, -2);
+	duk_set_prototype(ctx, 0);
+
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "reason");
+	duk_push_c_function(ctx, dukky_autocomplete_error_event_reason_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Set the destructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_autocomplete_error_event___destructor, 1);
+	duk_set_finalizer(ctx, -2);
+	duk_pop(ctx);
+
+	/* Set the constructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_autocomplete_error_event___constructor, 1);
+	duk_put_prop_string(ctx, -2, "\xFF\xFFNETSURF_DUKTAPE_INIT");
+	duk_pop(ctx);
+
+	return 1; /* The prototype object */
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
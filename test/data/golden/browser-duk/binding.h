@@ -0,0 +1,144 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#ifndef dukky_binding_h
+#define dukky_binding_h
+
+#define _MAGIC(S) ("\xFF\xFFNETSURF_DUKTAPE_" S)
+#define MAGIC(S) _MAGIC(#S)
+#define PROTO_MAGIC MAGIC(PROTOTYPES)
+#define PRIVATE_MAGIC MAGIC(PRIVATE)
+#define INIT_MAGIC MAGIC(INIT)
+#define NODE_MAGIC MAGIC(NODE_MAP)
+#define _PROTO_NAME(K) _MAGIC("PROTOTYPE_" K)
+#define PROTO_NAME(K) _PROTO_NAME(#K)
+#define _PROP_NAME(K,V) _MAGIC(K "_PROPERTY_" V)
+#define PROP_NAME(K,V) _PROP_NAME(#K,#V)
+
+/* Constant strings */
+extern const char *dukky_error_fmt_argument;
+extern const char *dukky_error_fmt_bool_type;
+extern const char *dukky_error_fmt_number_type;
+extern const char *dukky_error_fmt_sequence_type;
+extern const char *dukky_magic_string_private;
+extern const char *dukky_magic_string_prototypes;
+extern const char *dukky_magic_string_keys;
+
+/* Interned property keys */
+enum dukky_key {
+	DUKKY_KEY_bubbles,
+	DUKKY_KEY_cancelable,
+	DUKKY_KEY_view,
+	DUKKY_KEY_detail,
+	DUKKY_KEY_data,
+	DUKKY_KEY_ctrlKey,
+	DUKKY_KEY_shiftKey,
+	DUKKY_KEY_altKey,
+	DUKKY_KEY_metaKey,
+	DUKKY_KEY_modifierAltGraph,
+	DUKKY_KEY_modifierCapsLock,
+	DUKKY_KEY_modifierFn,
+	DUKKY_KEY_modifierFnLock,
+	DUKKY_KEY_modifierHyper,
+	DUKKY_KEY_modifierNumLock,
+	DUKKY_KEY_modifierOS,
+	DUKKY_KEY_modifierScrollLock,
+	DUKKY_KEY_modifierSuper,
+	DUKKY_KEY_modifierSymbol,
+	DUKKY_KEY_modifierSymbolLock,
+	DUKKY_KEY_key,
+	DUKKY_KEY_code,
+	DUKKY_KEY_location,
+	DUKKY_KEY_repeat,
+	DUKKY_KEY_isComposing,
+	DUKKY_KEY_charCode,
+	DUKKY_KEY_keyCode,
+	DUKKY_KEY_which,
+	DUKKY_KEY_region,
+	DUKKY_KEY_screenX,
+	DUKKY_KEY_screenY,
+	DUKKY_KEY_clientX,
+	DUKKY_KEY_clientY,
+	DUKKY_KEY_button,
+	DUKKY_KEY_buttons,
+	DUKKY_KEY_relatedTarget,
+	DUKKY_KEY_deltaX,
+	DUKKY_KEY_deltaY,
+	DUKKY_KEY_deltaZ,
+	DUKKY_KEY_deltaMode,
+	DUKKY_KEY_oldValue,
+	DUKKY_KEY_newValue,
+	DUKKY_KEY_url,
+	DUKKY_KEY_storageArea,
+	DUKKY_KEY_wasClean,
+	DUKKY_KEY_reason,
+	DUKKY_KEY_withCredentials,
+	DUKKY_KEY_origin,
+	DUKKY_KEY_lastEventId,
+	DUKKY_KEY_source,
+	DUKKY_KEY_ports,
+	DUKKY_KEY_message,
+	DUKKY_KEY_filename,
+	DUKKY_KEY_lineno,
+	DUKKY_KEY_colno,
+	DUKKY_KEY_error,
+	DUKKY_KEY_persisted,
+	DUKKY_KEY_oldURL,
+	DUKKY_KEY_newURL,
+	DUKKY_KEY_state,
+	DUKKY_KEY_dataTransfer,
+	DUKKY_KEY_path,
+	DUKKY_KEY_fillRule,
+	DUKKY_KEY_id,
+	DUKKY_KEY_parentID,
+	DUKKY_KEY_cursor,
+	DUKKY_KEY_control,
+	DUKKY_KEY_label,
+	DUKKY_KEY_role,
+	DUKKY_KEY_alpha,
+	DUKKY_KEY_track,
+	DUKKY_KEY_childList,
+	DUKKY_KEY_attributes,
+	DUKKY_KEY_characterData,
+	DUKKY_KEY_subtree,
+	DUKKY_KEY_attributeOldValue,
+	DUKKY_KEY_characterDataOldValue,
+	DUKKY_KEY_attributeFilter,
+	DUKKY_KEY_value,
+	DUKKY_KEY_href,
+	DUKKY_KEY__COUNT
+};
+
+void dukky_push_key(duk_context *ctx, enum dukky_key key);
+
+duk_bool_t dukky_instanceof(duk_context *ctx, duk_idx_t index, const char *klass);
+/* Sequence marshalling */
+duk_idx_t dukky_push_string_sequence(duk_context *ctx, const char *const *seq, duk_size_t seqc);
+duk_size_t dukky_get_string_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, const char ***seq_out);
+duk_idx_t dukky_push_boolean_sequence(duk_context *ctx, duk_bool_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_boolean_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_bool_t **seq_out);
+duk_idx_t dukky_push_int_sequence(duk_context *ctx, duk_int_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_int_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_int_t **seq_out);
+duk_idx_t dukky_push_number_sequence(duk_context *ctx, duk_double_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_number_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_double_t **seq_out);
+duk_idx_t dukky_push_longlong_sequence(duk_context *ctx, long long const *seq, duk_size_t seqc);
+duk_size_t dukky_get_longlong_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, long long **seq_out);
+
+duk_ret_t dukky_create_prototypes(duk_context *ctx);
+
+#endif
+
+/* binding postface */
+		
\ No newline at end of file
@@ -0,0 +1,131 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+static void dukky_canvas_gradient___init(duk_context *ctx, canvas_gradient_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Initialise %p (priv=%p)", duk_get_heapptr(ctx, 0), priv);
+}
+
+static void dukky_canvas_gradient___fini(duk_context *ctx, canvas_gradient_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Finalise %p", duk_get_heapptr(ctx, 0));
+}
+
+static duk_ret_t dukky_canvas_gradient___constructor(duk_context *ctx)
+{
+	/* create private data and attach to instance */
+	canvas_gradient_private_t *priv = calloc(1, sizeof(*priv));
+	if (priv == NULL) return 0;
+	duk_push_pointer(ctx, priv);
+	duk_put_prop_string(ctx, 0, dukky_magic_string_private);
+
+	dukky_canvas_gradient___init(ctx, priv);
+	duk_set_top(ctx, 1);
+	return 1;
+}
+
+static duk_ret_t dukky_canvas_gradient___destructor(duk_context *ctx)
+{
+	canvas_gradient_private_t *priv;
+	duk_get_prop_string(ctx, 0, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+	if (priv == NULL) return 0;
+
+	dukky_canvas_gradient___fini(ctx, priv);
+	free(priv);
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_gradient_addColorStop(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	duk_set_top(ctx, 2);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "offset");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_string(ctx, 1)) {
+			duk_to_string(ctx, 1);
+		}
+	}
+	/* Get private data for method */
+	canvas_gradient_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+duk_ret_t dukky_canvas_gradient___proto(duk_context *ctx, void *udata)
+{
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "addColorStop");
+	duk_push_c_function(ctx, dukky_canvas_gradient_addColorStop, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Set the destructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_canvas_gradient___destructor, 1);
+	duk_set_finalizer(ctx, -2);
+	duk_pop(ctx);
+
+	/* Set the constructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_canvas_gradient___constructor, 1);
+	duk_put_prop_string(ctx, -2, "\xFF\xFFNETSURF_DUKTAPE_INIT");
+	duk_pop(ctx);
+
+	return 1; /* The prototype object */
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
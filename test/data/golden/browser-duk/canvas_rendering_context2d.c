@@ -0,0 +1,3475 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+static void dukky_canvas_rendering_context2d___init(duk_context *ctx, canvas_rendering_context2d_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Initialise %p (priv=%p)", duk_get_heapptr(ctx, 0), priv);
+}
+
+static void dukky_canvas_rendering_context2d___fini(duk_context *ctx, canvas_rendering_context2d_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Finalise %p", duk_get_heapptr(ctx, 0));
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d___constructor(duk_context *ctx)
+{
+	/* create private data and attach to instance */
+	canvas_rendering_context2d_private_t *priv = calloc(1, sizeof(*priv));
+	if (priv == NULL) return 0;
+	duk_push_pointer(ctx, priv);
+	duk_put_prop_string(ctx, 0, dukky_magic_string_private);
+
+	dukky_canvas_rendering_context2d___init(ctx, priv);
+	duk_set_top(ctx, 1);
+	return 1;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d___destructor(duk_context *ctx)
+{
+	canvas_rendering_context2d_private_t *priv;
+	duk_get_prop_string(ctx, 0, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+	if (priv == NULL) return 0;
+
+	dukky_canvas_rendering_context2d___fini(ctx, priv);
+	free(priv);
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_commit(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_save(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_restore(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_scale(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	duk_set_top(ctx, 2);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_rotate(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 1) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 1, dukky_argc);
+	}
+	duk_set_top(ctx, 1);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "angle");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_translate(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	duk_set_top(ctx, 2);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_transform(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 6) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 6, dukky_argc);
+	}
+	duk_set_top(ctx, 6);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "a");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "b");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "c");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "d");
+		}
+	}
+	if (dukky_argc > 4) {
+		if (!duk_is_number(ctx, 4)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 4, "e");
+		}
+	}
+	if (dukky_argc > 5) {
+		if (!duk_is_number(ctx, 5)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 5, "f");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_setTransform(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 6) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 6, dukky_argc);
+	}
+	duk_set_top(ctx, 6);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "a");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "b");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "c");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "d");
+		}
+	}
+	if (dukky_argc > 4) {
+		if (!duk_is_number(ctx, 4)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 4, "e");
+		}
+	}
+	if (dukky_argc > 5) {
+		if (!duk_is_number(ctx, 5)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 5, "f");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_resetTransform(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_createLinearGradient(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 4) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 4, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x0");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y0");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "x1");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "y1");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_createRadialGradient(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 6) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 6, dukky_argc);
+	}
+	duk_set_top(ctx, 6);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x0");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y0");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "r0");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "x1");
+		}
+	}
+	if (dukky_argc > 4) {
+		if (!duk_is_number(ctx, 4)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 4, "y1");
+		}
+	}
+	if (dukky_argc > 5) {
+		if (!duk_is_number(ctx, 5)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 5, "r1");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_createPattern(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	duk_set_top(ctx, 2);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		/* unhandled type check */
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_string(ctx, 1)) {
+			duk_to_string(ctx, 1);
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_clearRect(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 4) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 4, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "w");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "h");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_fillRect(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 4) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 4, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "w");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "h");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_strokeRect(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 4) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 4, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "w");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "h");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_beginPath(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_fill(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	switch (dukky_argc) {
+	case 0:
+		duk_push_string(ctx, "nonzero");
+		break;
+	default:
+		/* remove extraneous parameters */
+		duk_set_top(ctx, 1);
+	}
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		/* unhandled type check */
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_stroke(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_drawFocusIfNeeded(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 1) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 1, dukky_argc);
+	}
+	duk_set_top(ctx, 1);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		/* unhandled type check */
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_scrollPathIntoView(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_clip(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	switch (dukky_argc) {
+	case 0:
+		duk_push_string(ctx, "nonzero");
+		break;
+	default:
+		/* remove extraneous parameters */
+		duk_set_top(ctx, 1);
+	}
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		/* unhandled type check */
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_resetClip(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_isPointInPath(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	switch (dukky_argc) {
+	case 2:
+		duk_push_string(ctx, "nonzero");
+		break;
+	default:
+		/* remove extraneous parameters */
+		duk_set_top(ctx, 3);
+	}
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	if (dukky_argc > 2) {
+		/* unhandled type check */
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_isPointInStroke(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	duk_set_top(ctx, 2);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_fillText(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 3) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 3, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_string(ctx, 0)) {
+			duk_to_string(ctx, 0);
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "x");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "y");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "maxWidth");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_strokeText(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 3) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 3, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_string(ctx, 0)) {
+			duk_to_string(ctx, 0);
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "x");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "y");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "maxWidth");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_measureText(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 1) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 1, dukky_argc);
+	}
+	duk_set_top(ctx, 1);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_string(ctx, 0)) {
+			duk_to_string(ctx, 0);
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_drawImage(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 3) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 3, dukky_argc);
+	}
+	duk_set_top(ctx, 3);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		/* unhandled type check */
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "dx");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "dy");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_addHitRegion(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 1);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		/* unhandled type check */
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_removeHitRegion(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 1) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 1, dukky_argc);
+	}
+	duk_set_top(ctx, 1);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_string(ctx, 0)) {
+			duk_to_string(ctx, 0);
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_clearHitRegions(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_createImageData(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	duk_set_top(ctx, 2);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "sw");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "sh");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_getImageData(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 4) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 4, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "sx");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "sy");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "sw");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "sh");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_putImageData(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 3) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 3, dukky_argc);
+	}
+	duk_set_top(ctx, 3);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		/* unhandled type check */
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "dx");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "dy");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_setLineDash(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 1) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 1, dukky_argc);
+	}
+	duk_set_top(ctx, 1);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_array(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_sequence_type, 0, "segments");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_getLineDash(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_closePath(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	duk_set_top(ctx, 0);
+
+	/* check types of passed arguments are correct */
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_moveTo(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	duk_set_top(ctx, 2);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineTo(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 2) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 2, dukky_argc);
+	}
+	duk_set_top(ctx, 2);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_quadraticCurveTo(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 4) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 4, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "cpx");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "cpy");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "x");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "y");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_bezierCurveTo(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 6) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 6, dukky_argc);
+	}
+	duk_set_top(ctx, 6);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "cp1x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "cp1y");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "cp2x");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "cp2y");
+		}
+	}
+	if (dukky_argc > 4) {
+		if (!duk_is_number(ctx, 4)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 4, "x");
+		}
+	}
+	if (dukky_argc > 5) {
+		if (!duk_is_number(ctx, 5)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 5, "y");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_arcTo(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 5) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 5, dukky_argc);
+	}
+	duk_set_top(ctx, 5);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x1");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y1");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "x2");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "y2");
+		}
+	}
+	if (dukky_argc > 4) {
+		if (!duk_is_number(ctx, 4)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 4, "radius");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_rect(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 4) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 4, dukky_argc);
+	}
+	duk_set_top(ctx, 4);
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "w");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "h");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_arc(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 5) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 5, dukky_argc);
+	}
+	switch (dukky_argc) {
+	case 5:
+		duk_push_boolean(ctx, 0);
+		break;
+	default:
+		/* remove extraneous parameters */
+		duk_set_top(ctx, 6);
+	}
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "radius");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "startAngle");
+		}
+	}
+	if (dukky_argc > 4) {
+		if (!duk_is_number(ctx, 4)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 4, "endAngle");
+		}
+	}
+	if (dukky_argc > 5) {
+		if (!duk_is_boolean(ctx, 5)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_bool_type, 5, "anticlockwise");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_ellipse(duk_context *ctx)
+{
+	/* ensure the parameters are present */
+	duk_idx_t dukky_argc = duk_get_top(ctx);
+	if (dukky_argc < 7) {
+		/* not enough arguments */
+		return duk_error(ctx, DUK_RET_TYPE_ERROR, dukky_error_fmt_argument, 7, dukky_argc);
+	}
+	switch (dukky_argc) {
+	case 7:
+		duk_push_boolean(ctx, 0);
+		break;
+	default:
+		/* remove extraneous parameters */
+		duk_set_top(ctx, 8);
+	}
+
+	/* check types of passed arguments are correct */
+	if (dukky_argc > 0) {
+		if (!duk_is_number(ctx, 0)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 0, "x");
+		}
+	}
+	if (dukky_argc > 1) {
+		if (!duk_is_number(ctx, 1)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 1, "y");
+		}
+	}
+	if (dukky_argc > 2) {
+		if (!duk_is_number(ctx, 2)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 2, "radiusX");
+		}
+	}
+	if (dukky_argc > 3) {
+		if (!duk_is_number(ctx, 3)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 3, "radiusY");
+		}
+	}
+	if (dukky_argc > 4) {
+		if (!duk_is_number(ctx, 4)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 4, "rotation");
+		}
+	}
+	if (dukky_argc > 5) {
+		if (!duk_is_number(ctx, 5)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 5, "startAngle");
+		}
+	}
+	if (dukky_argc > 6) {
+		if (!duk_is_number(ctx, 6)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_number_type, 6, "endAngle");
+		}
+	}
+	if (dukky_argc > 7) {
+		if (!duk_is_boolean(ctx, 7)) {
+			return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_bool_type, 7, "anticlockwise");
+		}
+	}
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_canvas_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_width_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_width_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_height_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_height_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_currentTransform_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_currentTransform_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_globalAlpha_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_globalAlpha_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_globalCompositeOperation_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_globalCompositeOperation_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_imageSmoothingEnabled_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_imageSmoothingEnabled_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_strokeStyle_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_strokeStyle_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_fillStyle_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_fillStyle_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_shadowOffsetX_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_shadowOffsetX_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_shadowOffsetY_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_shadowOffsetY_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_shadowBlur_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_shadowBlur_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_shadowColor_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_shadowColor_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineWidth_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineWidth_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineCap_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineCap_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineJoin_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineJoin_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_miterLimit_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_miterLimit_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineDashOffset_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_lineDashOffset_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_font_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_font_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_textAlign_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_textAlign_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_textBaseline_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_textBaseline_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_direction_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_canvas_rendering_context2d_direction_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	canvas_rendering_context2d_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+duk_ret_t dukky_canvas_rendering_context2d___proto(duk_context *ctx, void *udata)
+{
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "commit");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_commit, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "save");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_save, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "restore");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_restore, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "scale");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_scale, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "rotate");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_rotate, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "translate");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_translate, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "transform");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_transform, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "setTransform");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_setTransform, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "resetTransform");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_resetTransform, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "createLinearGradient");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_createLinearGradient, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "createRadialGradient");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_createRadialGradient, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "createPattern");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_createPattern, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "clearRect");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_clearRect, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "fillRect");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_fillRect, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "strokeRect");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_strokeRect, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "beginPath");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_beginPath, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "fill");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_fill, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "stroke");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_stroke, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "drawFocusIfNeeded");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_drawFocusIfNeeded, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "scrollPathIntoView");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_scrollPathIntoView, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "clip");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_clip, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "resetClip");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_resetClip, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "isPointInPath");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_isPointInPath, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "isPointInStroke");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_isPointInStroke, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "fillText");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_fillText, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "strokeText");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_strokeText, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "measureText");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_measureText, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "drawImage");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_drawImage, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "addHitRegion");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_addHitRegion, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "removeHitRegion");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_removeHitRegion, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "clearHitRegions");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_clearHitRegions, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "createImageData");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_createImageData, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "getImageData");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_getImageData, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "putImageData");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_putImageData, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "setLineDash");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_setLineDash, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "getLineDash");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_getLineDash, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "closePath");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_closePath, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "moveTo");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_moveTo, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "lineTo");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineTo, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "quadraticCurveTo");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_quadraticCurveTo, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "bezierCurveTo");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_bezierCurveTo, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "arcTo");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_arcTo, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "rect");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_rect, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "arc");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_arc, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add a method */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "ellipse");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_ellipse, DUK_VARARGS);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3,
+		     DUK_DEFPROP_HAVE_VALUE |
+		     DUK_DEFPROP_HAVE_WRITABLE |
+		     DUK_DEFPROP_HAVE_ENUMERABLE |
+		     DUK_DEFPROP_ENUMERABLE |
+		     DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add readonly property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "canvas");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_canvas_getter, 0);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "width");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_width_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_width_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "height");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_height_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_height_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "currentTransform");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_currentTransform_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_currentTransform_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "globalAlpha");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_globalAlpha_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_globalAlpha_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "globalCompositeOperation");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_globalCompositeOperation_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_globalCompositeOperation_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "imageSmoothingEnabled");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_imageSmoothingEnabled_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_imageSmoothingEnabled_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "strokeStyle");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_strokeStyle_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_strokeStyle_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "fillStyle");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_fillStyle_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_fillStyle_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "shadowOffsetX");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_shadowOffsetX_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_shadowOffsetX_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "shadowOffsetY");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_shadowOffsetY_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_shadowOffsetY_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "shadowBlur");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_shadowBlur_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_shadowBlur_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "shadowColor");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_shadowColor_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_shadowColor_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "lineWidth");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineWidth_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineWidth_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "lineCap");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineCap_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineCap_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "lineJoin");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineJoin_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineJoin_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "miterLimit");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_miterLimit_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_miterLimit_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "lineDashOffset");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineDashOffset_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_lineDashOffset_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "font");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_font_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_font_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "textAlign");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_textAlign_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_textAlign_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "textBaseline");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_textBaseline_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_textBaseline_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "direction");
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_direction_getter, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d_direction_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Set the destructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d___destructor, 1);
+	duk_set_finalizer(ctx, -2);
+	duk_pop(ctx);
+
+	/* Set the constructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_canvas_rendering_context2d___constructor, 1);
+	duk_put_prop_string(ctx, -2, "\xFF\xFFNETSURF_DUKTAPE_INIT");
+	duk_pop(ctx);
+
+	return 1; /* The prototype object */
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
@@ -0,0 +1,61 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+duk_bool_t
+dukky_canvas_rendering_context2d_settings_get_alpha(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = true; /* Default value of alpha */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_alpha);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_canvas_rendering_context2d_settings_unpack(duk_context *ctx, duk_idx_t idx, canvas_rendering_context2d_settings_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	out->alpha = true; /* Default value of alpha */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_alpha);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->alpha = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
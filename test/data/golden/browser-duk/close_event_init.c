@@ -0,0 +1,110 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+duk_bool_t
+dukky_close_event_init_get_wasClean(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_wasClean);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_close_event_init_get_code(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_code);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+const char *
+dukky_close_event_init_get_reason(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_reason);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_close_event_init_unpack(duk_context *ctx, duk_idx_t idx, close_event_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_event_init_unpack(ctx, idx, &out->parent);
+	out->wasClean = false; /* No default */
+	out->code = 0; /* No default */
+	out->reason = NULL; /* No default */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_wasClean);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->wasClean = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_code);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->code = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_reason);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->reason = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
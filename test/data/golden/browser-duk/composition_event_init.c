@@ -0,0 +1,62 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+const char *
+dukky_composition_event_init_get_data(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = ""; /* Default value of data */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_data);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_composition_event_init_unpack(duk_context *ctx, duk_idx_t idx, composition_event_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_ui_event_init_unpack(ctx, idx, &out->parent);
+	out->data = ""; /* Default value of data */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_data);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->data = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
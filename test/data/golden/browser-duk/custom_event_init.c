@@ -0,0 +1,40 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+/* Dictionary CustomEventInit:detail unhandled type (0) */
+
+void
+dukky_custom_event_init_unpack(duk_context *ctx, duk_idx_t idx, custom_event_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_event_init_unpack(ctx, idx, &out->parent);
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
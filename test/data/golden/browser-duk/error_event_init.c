@@ -0,0 +1,136 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+const char *
+dukky_error_event_init_get_message(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_message);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+const char *
+dukky_error_event_init_get_filename(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_filename);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_error_event_init_get_lineno(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_lineno);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_error_event_init_get_colno(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_colno);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+/* Dictionary ErrorEventInit:error unhandled type (0) */
+
+void
+dukky_error_event_init_unpack(duk_context *ctx, duk_idx_t idx, error_event_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_event_init_unpack(ctx, idx, &out->parent);
+	out->message = NULL; /* No default */
+	out->filename = NULL; /* No default */
+	out->lineno = 0; /* No default */
+	out->colno = 0; /* No default */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_message);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->message = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_filename);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->filename = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_lineno);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->lineno = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_colno);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->colno = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
@@ -0,0 +1,85 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+duk_bool_t
+dukky_event_init_get_bubbles(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of bubbles */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_bubbles);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_init_get_cancelable(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of cancelable */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_cancelable);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_event_init_unpack(duk_context *ctx, duk_idx_t idx, event_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	out->bubbles = false; /* Default value of bubbles */
+	out->cancelable = false; /* Default value of cancelable */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_bubbles);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->bubbles = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_cancelable);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->cancelable = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
@@ -0,0 +1,398 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+duk_bool_t
+dukky_event_modifier_init_get_ctrlKey(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of ctrlKey */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_ctrlKey);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_shiftKey(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of shiftKey */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_shiftKey);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_altKey(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of altKey */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_altKey);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_metaKey(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of metaKey */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_metaKey);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierAltGraph(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierAltGraph */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierAltGraph);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierCapsLock(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierCapsLock */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierCapsLock);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierFn(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierFn */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierFn);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierFnLock(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierFnLock */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierFnLock);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierHyper(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierHyper */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierHyper);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierNumLock(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierNumLock */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierNumLock);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierOS(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierOS */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierOS);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierScrollLock(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierScrollLock */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierScrollLock);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierSuper(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierSuper */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierSuper);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierSymbol(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierSymbol */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierSymbol);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_event_modifier_init_get_modifierSymbolLock(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of modifierSymbolLock */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_modifierSymbolLock);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_event_modifier_init_unpack(duk_context *ctx, duk_idx_t idx, event_modifier_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_ui_event_init_unpack(ctx, idx, &out->parent);
+	out->ctrlKey = false; /* Default value of ctrlKey */
+	out->shiftKey = false; /* Default value of shiftKey */
+	out->altKey = false; /* Default value of altKey */
+	out->metaKey = false; /* Default value of metaKey */
+	out->modifierAltGraph = false; /* Default value of modifierAltGraph */
+	out->modifierCapsLock = false; /* Default value of modifierCapsLock */
+	out->modifierFn = false; /* Default value of modifierFn */
+	out->modifierFnLock = false; /* Default value of modifierFnLock */
+	out->modifierHyper = false; /* Default value of modifierHyper */
+	out->modifierNumLock = false; /* Default value of modifierNumLock */
+	out->modifierOS = false; /* Default value of modifierOS */
+	out->modifierScrollLock = false; /* Default value of modifierScrollLock */
+	out->modifierSuper = false; /* Default value of modifierSuper */
+	out->modifierSymbol = false; /* Default value of modifierSymbol */
+	out->modifierSymbolLock = false; /* Default value of modifierSymbolLock */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_ctrlKey);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->ctrlKey = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_shiftKey);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->shiftKey = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_altKey);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->altKey = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_metaKey);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->metaKey = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierAltGraph);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierAltGraph = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierCapsLock);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierCapsLock = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierFn);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierFn = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierFnLock);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierFnLock = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierHyper);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierHyper = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierNumLock);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierNumLock = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierOS);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierOS = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierScrollLock);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierScrollLock = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierSuper);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierSuper = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierSymbol);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierSymbol = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_modifierSymbolLock);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->modifierSymbolLock = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
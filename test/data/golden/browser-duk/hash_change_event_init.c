@@ -0,0 +1,86 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+const char *
+dukky_hash_change_event_init_get_oldURL(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_oldURL);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+const char *
+dukky_hash_change_event_init_get_newURL(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_newURL);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_hash_change_event_init_unpack(duk_context *ctx, duk_idx_t idx, hash_change_event_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_event_init_unpack(ctx, idx, &out->parent);
+	out->oldURL = NULL; /* No default */
+	out->newURL = NULL; /* No default */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_oldURL);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->oldURL = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_newURL);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->newURL = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
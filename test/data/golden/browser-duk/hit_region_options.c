@@ -0,0 +1,163 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+/* Dictionary HitRegionOptions:path unhandled type (1) */
+
+/* Dictionary HitRegionOptions:fillRule unhandled type (1) */
+
+const char *
+dukky_hit_region_options_get_id(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = ""; /* Default value of id */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_id);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+const char *
+dukky_hit_region_options_get_parentID(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* Default value of parentID */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_parentID);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+const char *
+dukky_hit_region_options_get_cursor(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = "inherit"; /* Default value of cursor */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_cursor);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+/* Dictionary HitRegionOptions:control unhandled type (1) */
+
+const char *
+dukky_hit_region_options_get_label(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* Default value of label */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_label);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+const char *
+dukky_hit_region_options_get_role(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* Default value of role */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_role);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_hit_region_options_unpack(duk_context *ctx, duk_idx_t idx, hit_region_options_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	out->id = ""; /* Default value of id */
+	out->parentID = NULL; /* Default value of parentID */
+	out->cursor = "inherit"; /* Default value of cursor */
+	out->label = NULL; /* Default value of label */
+	out->role = NULL; /* Default value of role */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_id);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->id = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_parentID);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->parentID = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_cursor);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->cursor = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_label);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->label = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_role);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->role = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
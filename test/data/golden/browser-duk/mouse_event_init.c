@@ -0,0 +1,208 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+const char *
+dukky_mouse_event_init_get_region(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = NULL; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_region);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_mouse_event_init_get_screenX(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* Default value of screenX */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_screenX);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_mouse_event_init_get_screenY(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* Default value of screenY */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_screenY);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_mouse_event_init_get_clientX(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* Default value of clientX */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_clientX);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_mouse_event_init_get_clientY(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* Default value of clientY */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_clientY);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_mouse_event_init_get_button(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* Default value of button */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_button);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_mouse_event_init_get_buttons(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* Default value of buttons */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_buttons);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+/* Dictionary MouseEventInit:relatedTarget unhandled type (1) */
+
+void
+dukky_mouse_event_init_unpack(duk_context *ctx, duk_idx_t idx, mouse_event_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_event_modifier_init_unpack(ctx, idx, &out->parent);
+	out->region = NULL; /* No default */
+	out->screenX = 0; /* Default value of screenX */
+	out->screenY = 0; /* Default value of screenY */
+	out->clientX = 0; /* Default value of clientX */
+	out->clientY = 0; /* Default value of clientY */
+	out->button = 0; /* Default value of button */
+	out->buttons = 0; /* Default value of buttons */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_region);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->region = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_screenX);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->screenX = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_screenY);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->screenY = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_clientX);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->clientX = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_clientY);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->clientY = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_button);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->button = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_buttons);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->buttons = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
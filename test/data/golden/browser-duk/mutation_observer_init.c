@@ -0,0 +1,213 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+duk_bool_t
+dukky_mutation_observer_init_get_childList(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of childList */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_childList);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_mutation_observer_init_get_attributes(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_attributes);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_mutation_observer_init_get_characterData(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_characterData);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_mutation_observer_init_get_subtree(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of subtree */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_subtree);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_mutation_observer_init_get_attributeOldValue(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_attributeOldValue);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_bool_t
+dukky_mutation_observer_init_get_characterDataOldValue(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_characterDataOldValue);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_size_t
+dukky_mutation_observer_init_get_attributeFilter(duk_context *ctx, duk_idx_t idx, int argi, const char ***seq_out)
+{
+	duk_size_t ret = 0; /* No default */
+	duk_size_t seqi;
+	const char **seq;
+	*seq_out = NULL;
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_attributeFilter);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a sequence */
+		ret = dukky_get_string_sequence(ctx, -1, argi, "attributeFilter", &seq);
+		/* ... obj@idx ... value elements */
+		if (ret > 0) {
+			*seq_out = malloc(ret * sizeof(*seq));
+			if (*seq_out == NULL) {
+				return duk_error(ctx, DUK_ERR_ERROR, "out of memory");
+			}
+		}
+		for (seqi = 0; seqi < ret; seqi++) {
+			(*seq_out)[seqi] = seq[seqi];
+		}
+		duk_pop(ctx);
+	}
+	duk_pop(ctx);
+	/* ... obj@idx ... */
+	return ret;
+}
+
+void
+dukky_mutation_observer_init_unpack(duk_context *ctx, duk_idx_t idx, mutation_observer_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	out->childList = false; /* Default value of childList */
+	out->attributes = false; /* No default */
+	out->characterData = false; /* No default */
+	out->subtree = false; /* Default value of subtree */
+	out->attributeOldValue = false; /* No default */
+	out->characterDataOldValue = false; /* No default */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_childList);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->childList = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_attributes);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->attributes = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_characterData);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->characterData = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_subtree);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->subtree = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_attributeOldValue);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->attributeOldValue = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_characterDataOldValue);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->characterDataOldValue = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
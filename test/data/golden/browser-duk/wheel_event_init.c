@@ -0,0 +1,134 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* DukTape JavaScript bindings for NetSurf browser
+ *
+ * Copyright 2015 Vincent Sanders <vince@netsurf-browser.org>
+ * This file is part of NetSurf, http://www.netsurf-browser.org/
+ * Released under the terms of the MIT License,
+ *        http://www.opensource.org/licenses/mit-license
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* binding prologue */
+		
+duk_double_t
+dukky_wheel_event_init_get_deltaX(duk_context *ctx, duk_idx_t idx)
+{
+	duk_double_t ret = 0.000000; /* Default value of deltaX */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_deltaX);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a number */
+		ret = duk_require_number(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_double_t
+dukky_wheel_event_init_get_deltaY(duk_context *ctx, duk_idx_t idx)
+{
+	duk_double_t ret = 0.000000; /* Default value of deltaY */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_deltaY);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a number */
+		ret = duk_require_number(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_double_t
+dukky_wheel_event_init_get_deltaZ(duk_context *ctx, duk_idx_t idx)
+{
+	duk_double_t ret = 0.000000; /* Default value of deltaZ */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_deltaZ);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a number */
+		ret = duk_require_number(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_wheel_event_init_get_deltaMode(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* Default value of deltaMode */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_deltaMode);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_wheel_event_init_unpack(duk_context *ctx, duk_idx_t idx, wheel_event_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_mouse_event_init_unpack(ctx, idx, &out->parent);
+	out->deltaX = 0.000000; /* Default value of deltaX */
+	out->deltaY = 0.000000; /* Default value of deltaY */
+	out->deltaZ = 0.000000; /* Default value of deltaZ */
+	out->deltaMode = 0; /* Default value of deltaMode */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_deltaX);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->deltaX = duk_require_number(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_deltaY);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->deltaY = duk_require_number(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_deltaZ);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->deltaZ = duk_require_number(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_deltaMode);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->deltaMode = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
+
+/* binding epilogue */
+		
+/* binding postface */
+		
\ No newline at end of file
@@ -0,0 +1,38 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_private_h
+#define dukky_private_h
+
+/* Private data for Location interface */
+typedef struct {
+} __attribute__((aligned)) location_private_t;
+
+/* Private data for Node interface */
+typedef struct {
+	dom_node *node;
+} __attribute__((aligned)) node_private_t;
+
+/* Private data for Text interface */
+typedef struct {
+	node_private_t parent;
+} __attribute__((aligned)) text_private_t;
+
+/* Private data for Element interface */
+typedef struct {
+	node_private_t parent;
+} __attribute__((aligned)) element_private_t;
+
+/* Private data for HTMLElement interface */
+typedef struct {
+	element_private_t parent;
+} __attribute__((aligned)) html_element_private_t;
+
+
+#endif
@@ -0,0 +1,48 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_binding_h
+#define dukky_binding_h
+
+#define _MAGIC(S) ("\xFF\xFFNETSURF_DUKTAPE_" S)
+#define MAGIC(S) _MAGIC(#S)
+#define PROTO_MAGIC MAGIC(PROTOTYPES)
+#define PRIVATE_MAGIC MAGIC(PRIVATE)
+#define INIT_MAGIC MAGIC(INIT)
+#define NODE_MAGIC MAGIC(NODE_MAP)
+#define _PROTO_NAME(K) _MAGIC("PROTOTYPE_" K)
+#define PROTO_NAME(K) _PROTO_NAME(#K)
+#define _PROP_NAME(K,V) _MAGIC(K "_PROPERTY_" V)
+#define PROP_NAME(K,V) _PROP_NAME(#K,#V)
+
+/* Constant strings */
+extern const char *dukky_error_fmt_argument;
+extern const char *dukky_error_fmt_bool_type;
+extern const char *dukky_error_fmt_number_type;
+extern const char *dukky_error_fmt_sequence_type;
+extern const char *dukky_magic_string_private;
+extern const char *dukky_magic_string_prototypes;
+extern const char *dukky_magic_string_keys;
+
+duk_bool_t dukky_instanceof(duk_context *ctx, duk_idx_t index, const char *klass);
+/* Sequence marshalling */
+duk_idx_t dukky_push_string_sequence(duk_context *ctx, const char *const *seq, duk_size_t seqc);
+duk_size_t dukky_get_string_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, const char ***seq_out);
+duk_idx_t dukky_push_boolean_sequence(duk_context *ctx, duk_bool_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_boolean_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_bool_t **seq_out);
+duk_idx_t dukky_push_int_sequence(duk_context *ctx, duk_int_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_int_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_int_t **seq_out);
+duk_idx_t dukky_push_number_sequence(duk_context *ctx, duk_double_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_number_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_double_t **seq_out);
+duk_idx_t dukky_push_longlong_sequence(duk_context *ctx, long long const *seq, duk_size_t seqc);
+duk_size_t dukky_get_longlong_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, long long **seq_out);
+
+duk_ret_t dukky_create_prototypes(duk_context *ctx);
+
+#endif
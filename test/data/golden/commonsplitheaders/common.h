@@ -0,0 +1,15 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_common_h
+#define dukky_common_h
+
+#include "@OUTPUT@/binding.h"
+
+#endif
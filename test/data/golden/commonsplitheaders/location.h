@@ -0,0 +1,20 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_location_h
+#define dukky_location_h
+
+/* Private data for Location interface */
+typedef struct {
+} __attribute__((aligned)) location_private_t;
+
+duk_ret_t dukky_location___proto(duk_context *ctx, void *udata);
+
+
+#endif
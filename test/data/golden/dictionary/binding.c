@@ -0,0 +1,369 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* Error format strings */
+const char *dukky_error_fmt_argument ="%d argument required, but ony %d present.";
+const char *dukky_error_fmt_bool_type ="argument %d (%s) requires a bool";
+const char *dukky_error_fmt_number_type ="argument %d (%s) requires a number";
+const char *dukky_error_fmt_sequence_type ="argument %d (%s) requires a sequence";
+
+/* Magic identifiers */
+const char *dukky_magic_string_private ="\xFF\xFFNETSURF_DUKTAPE_PRIVATE";
+const char *dukky_magic_string_prototypes ="\xFF\xFFNETSURF_DUKTAPE_PROTOTYPES";
+const char *dukky_magic_string_keys ="\xFF\xFFNETSURF_DUKTAPE_KEYS";
+
+duk_bool_t
+dukky_instanceof(duk_context *ctx, duk_idx_t _idx, const char *klass)
+{
+	duk_idx_t idx = duk_normalize_index(ctx, _idx);
+	/* ... ??? ... */
+	if (!duk_check_type(ctx, idx, DUK_TYPE_OBJECT)) {
+		return false;
+	}
+	/* ... obj ... */
+	duk_get_global_string(ctx, dukky_magic_string_prototypes);
+	/* ... obj ... protos */
+	duk_get_prop_string(ctx, -1, klass);
+	/* ... obj ... protos goalproto */
+	duk_get_prototype(ctx, idx);
+	/* ... obj ... protos goalproto proto? */
+	while (!duk_is_undefined(ctx, -1)) {
+		if (duk_strict_equals(ctx, -1, -2)) {
+			duk_pop_3(ctx);
+			/* ... obj ... */
+			return true;
+		}
+		duk_get_prototype(ctx, -1);
+		/* ... obj ... protos goalproto proto proto? */
+		duk_replace(ctx, -2);
+		/* ... obj ... protos goalproto proto? */
+	}
+	duk_pop_3(ctx);
+	/* ... obj ... */
+	return false;
+}
+
+/* Interned property keys */
+static const char *dukky_key_names[DUKKY_KEY__COUNT] = {
+	"flag",
+	"name",
+	"count",
+	"offsets",
+	"detail",
+	"kind",
+};
+
+#define DUKKY_KEY__HEAPS 4
+
+struct dukky_key_cache {
+	void *stash;
+	void *keys[DUKKY_KEY__COUNT];
+};
+
+static struct dukky_key_cache dukky_key_cachev[DUKKY_KEY__HEAPS];
+static struct dukky_key_cache *dukky_key_cache = &dukky_key_cachev[0];
+static unsigned int dukky_key_cachei;
+
+static void dukky_load_keys(duk_context *ctx, void *stash, duk_bool_t reload)
+{
+	struct dukky_key_cache *cache = NULL;
+	duk_uarridx_t keyi;
+	for (keyi = 0; keyi < DUKKY_KEY__HEAPS; keyi++) {
+		if (dukky_key_cachev[keyi].stash == stash) {
+			cache = &dukky_key_cachev[keyi];
+			break;
+		}
+	}
+	if ((cache != NULL) && !reload) {
+		dukky_key_cache = cache;
+		return;
+	}
+	if (cache == NULL) {
+		cache = &dukky_key_cachev[dukky_key_cachei];
+		dukky_key_cachei = (dukky_key_cachei + 1) % DUKKY_KEY__HEAPS;
+	}
+	/* ... stash */
+	duk_get_prop_string(ctx, -1, dukky_magic_string_keys);
+	/* ... stash keys */
+	for (keyi = 0; keyi < DUKKY_KEY__COUNT; keyi++) {
+		duk_get_prop_index(ctx, -1, keyi);
+		cache->keys[keyi] = duk_get_heapptr(ctx, -1);
+		duk_pop(ctx);
+	}
+	duk_pop(ctx);
+	/* ... stash */
+	cache->stash = stash;
+	dukky_key_cache = cache;
+}
+
+static void dukky_intern_keys(duk_context *ctx)
+{
+	duk_uarridx_t keyi;
+	duk_push_global_stash(ctx);
+	duk_push_array(ctx);
+	/* stash keys */
+	for (keyi = 0; keyi < DUKKY_KEY__COUNT; keyi++) {
+		duk_push_string(ctx, dukky_key_names[keyi]);
+		duk_put_prop_index(ctx, -2, keyi);
+	}
+	duk_put_prop_string(ctx, -2, dukky_magic_string_keys);
+	/* stash */
+	dukky_load_keys(ctx, duk_get_heapptr(ctx, -1), 1);
+	duk_pop(ctx);
+}
+
+void dukky_push_key(duk_context *ctx, enum dukky_key key)
+{
+	void *stash;
+	duk_push_global_stash(ctx);
+	stash = duk_get_heapptr(ctx, -1);
+	/* ... stash */
+	if (dukky_key_cache->stash != stash) {
+		/* cached keys belong to another heap */
+		dukky_load_keys(ctx, stash, 0);
+	}
+	duk_pop(ctx);
+	duk_push_heapptr(ctx, dukky_key_cache->keys[key]);
+	/* ... key */
+}
+
+duk_idx_t
+dukky_push_string_sequence(duk_context *ctx, const char *const *seq, duk_size_t seqc)
+{
+	duk_idx_t arr_idx;
+	duk_uarridx_t seqi;
+	arr_idx = duk_push_array(ctx);
+	/* ... arr */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_push_string(ctx, seq[seqi]);
+		duk_put_prop_index(ctx, arr_idx, seqi);
+	}
+	return arr_idx;
+}
+
+duk_size_t
+dukky_get_string_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, const char ***seq_out)
+{
+	duk_size_t seqc;
+	duk_uarridx_t seqi;
+	const char **seq;
+	idx = duk_normalize_index(ctx, idx);
+	if (!duk_is_array(ctx, idx)) {
+		return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_sequence_type, argi, argname);
+	}
+	seqc = duk_get_length(ctx, idx);
+	seq = duk_push_fixed_buffer(ctx, seqc * sizeof(*seq));
+	/* ... arr@idx ... elements */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_get_prop_index(ctx, idx, seqi);
+		seq[seqi] = duk_require_string(ctx, -1);
+		duk_pop(ctx);
+	}
+	*seq_out = seq;
+	return seqc;
+}
+
+duk_idx_t
+dukky_push_boolean_sequence(duk_context *ctx, duk_bool_t const *seq, duk_size_t seqc)
+{
+	duk_idx_t arr_idx;
+	duk_uarridx_t seqi;
+	arr_idx = duk_push_array(ctx);
+	/* ... arr */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_push_boolean(ctx, seq[seqi]);
+		duk_put_prop_index(ctx, arr_idx, seqi);
+	}
+	return arr_idx;
+}
+
+duk_size_t
+dukky_get_boolean_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_bool_t **seq_out)
+{
+	duk_size_t seqc;
+	duk_uarridx_t seqi;
+	duk_bool_t *seq;
+	idx = duk_normalize_index(ctx, idx);
+	if (!duk_is_array(ctx, idx)) {
+		return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_sequence_type, argi, argname);
+	}
+	seqc = duk_get_length(ctx, idx);
+	seq = duk_push_fixed_buffer(ctx, seqc * sizeof(*seq));
+	/* ... arr@idx ... elements */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_get_prop_index(ctx, idx, seqi);
+		seq[seqi] = duk_require_boolean(ctx, -1);
+		duk_pop(ctx);
+	}
+	*seq_out = seq;
+	return seqc;
+}
+
+duk_idx_t
+dukky_push_int_sequence(duk_context *ctx, duk_int_t const *seq, duk_size_t seqc)
+{
+	duk_idx_t arr_idx;
+	duk_uarridx_t seqi;
+	arr_idx = duk_push_array(ctx);
+	/* ... arr */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_push_int(ctx, seq[seqi]);
+		duk_put_prop_index(ctx, arr_idx, seqi);
+	}
+	return arr_idx;
+}
+
+duk_size_t
+dukky_get_int_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_int_t **seq_out)
+{
+	duk_size_t seqc;
+	duk_uarridx_t seqi;
+	duk_int_t *seq;
+	idx = duk_normalize_index(ctx, idx);
+	if (!duk_is_array(ctx, idx)) {
+		return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_sequence_type, argi, argname);
+	}
+	seqc = duk_get_length(ctx, idx);
+	seq = duk_push_fixed_buffer(ctx, seqc * sizeof(*seq));
+	/* ... arr@idx ... elements */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_get_prop_index(ctx, idx, seqi);
+		seq[seqi] = duk_require_int(ctx, -1);
+		duk_pop(ctx);
+	}
+	*seq_out = seq;
+	return seqc;
+}
+
+duk_idx_t
+dukky_push_number_sequence(duk_context *ctx, duk_double_t const *seq, duk_size_t seqc)
+{
+	duk_idx_t arr_idx;
+	duk_uarridx_t seqi;
+	arr_idx = duk_push_array(ctx);
+	/* ... arr */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_push_number(ctx, seq[seqi]);
+		duk_put_prop_index(ctx, arr_idx, seqi);
+	}
+	return arr_idx;
+}
+
+duk_size_t
+dukky_get_number_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_double_t **seq_out)
+{
+	duk_size_t seqc;
+	duk_uarridx_t seqi;
+	duk_double_t *seq;
+	idx = duk_normalize_index(ctx, idx);
+	if (!duk_is_array(ctx, idx)) {
+		return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_sequence_type, argi, argname);
+	}
+	seqc = duk_get_length(ctx, idx);
+	seq = duk_push_fixed_buffer(ctx, seqc * sizeof(*seq));
+	/* ... arr@idx ... elements */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_get_prop_index(ctx, idx, seqi);
+		seq[seqi] = duk_require_number(ctx, -1);
+		duk_pop(ctx);
+	}
+	*seq_out = seq;
+	return seqc;
+}
+
+duk_idx_t
+dukky_push_longlong_sequence(duk_context *ctx, long long const *seq, duk_size_t seqc)
+{
+	duk_idx_t arr_idx;
+	duk_uarridx_t seqi;
+	arr_idx = duk_push_array(ctx);
+	/* ... arr */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_push_number(ctx, seq[seqi]);
+		duk_put_prop_index(ctx, arr_idx, seqi);
+	}
+	return arr_idx;
+}
+
+duk_size_t
+dukky_get_longlong_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, long long **seq_out)
+{
+	duk_size_t seqc;
+	duk_uarridx_t seqi;
+	long long *seq;
+	idx = duk_normalize_index(ctx, idx);
+	if (!duk_is_array(ctx, idx)) {
+		return duk_error(ctx, DUK_ERR_ERROR, dukky_error_fmt_sequence_type, argi, argname);
+	}
+	seqc = duk_get_length(ctx, idx);
+	seq = duk_push_fixed_buffer(ctx, seqc * sizeof(*seq));
+	/* ... arr@idx ... elements */
+	for (seqi = 0; seqi < seqc; seqi++) {
+		duk_get_prop_index(ctx, idx, seqi);
+		seq[seqi] = (long long)duk_get_number(ctx, -1);
+		duk_pop(ctx);
+	}
+	*seq_out = seq;
+	return seqc;
+}
+
+static duk_ret_t
+dukky_to_string(duk_context *ctx)
+{
+	/* */
+	duk_push_this(ctx);
+	/* this */
+	duk_get_prototype(ctx, -1);
+	/* this proto */
+	duk_get_prop_string(ctx, -1, "\xFF\xFFNETSURF_DUKTAPE_klass_name");
+	/* this proto classname */
+	duk_push_string(ctx, "[object ");
+	/* this proto classname str */
+	duk_insert(ctx, -2);
+	/* this proto str classname */
+	duk_push_string(ctx, "]");
+	/* this proto str classname str */
+	duk_concat(ctx, 3);
+	/* this proto str */
+	return 1;
+}
+
+static duk_ret_t dukky_create_prototype(duk_context *ctx,
+					duk_safe_call_function genproto,
+					const char *proto_name,
+					const char *klass_name)
+{
+	duk_int_t ret;
+	duk_push_object(ctx);
+	if ((ret = duk_safe_call(ctx, genproto, NULL, 1, 1)) != DUK_EXEC_SUCCESS) {
+		duk_pop(ctx);
+		NSLOG(dukky, WARNING, "Failed to register prototype for %s", proto_name + 2);
+		return ret;
+	}
+	/* top of stack is the ready prototype, inject it */
+	duk_push_string(ctx, klass_name);
+	duk_put_prop_string(ctx, -2, "\xFF\xFFNETSURF_DUKTAPE_klass_name");
+	duk_push_c_function(ctx, dukky_to_string, 0);
+	duk_put_prop_string(ctx, -2, "toString");
+	duk_push_string(ctx, "toString");
+	duk_def_prop(ctx, -2, DUK_DEFPROP_HAVE_ENUMERABLE);
+	duk_put_global_string(ctx, proto_name);
+	return DUK_ERR_NONE;
+}
+
+duk_ret_t dukky_create_prototypes(duk_context *ctx)
+{
+	dukky_intern_keys(ctx);
+
+	dukky_create_prototype(ctx, dukky_dictionary_example___proto, "\xFF\xFFNETSURF_DUKTAPE_PROTOTYPE_DICTIONARYEXAMPLE", "DictionaryExample");
+
+	return DUK_ERR_NONE;
+}
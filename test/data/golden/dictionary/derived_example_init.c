@@ -0,0 +1,49 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+/* Dictionary DerivedExampleInit:detail unhandled type (0) */
+
+duk_int_t
+dukky_derived_example_init_get_kind(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 2; /* Default value of kind */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_kind);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+void
+dukky_derived_example_init_unpack(duk_context *ctx, duk_idx_t idx, derived_example_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	dukky_example_init_unpack(ctx, idx, &out->parent);
+	out->kind = 2; /* Default value of kind */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_kind);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->kind = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
@@ -0,0 +1,126 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+duk_bool_t
+dukky_example_init_get_flag(duk_context *ctx, duk_idx_t idx)
+{
+	duk_bool_t ret = false; /* Default value of flag */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_flag);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a boolean */
+		ret = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+const char *
+dukky_example_init_get_name(duk_context *ctx, duk_idx_t idx)
+{
+	const char *ret = "example"; /* Default value of name */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_name);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a string */
+		ret = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_int_t
+dukky_example_init_get_count(duk_context *ctx, duk_idx_t idx)
+{
+	duk_int_t ret = 0; /* No default */
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_count);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a int */
+		ret = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+	return ret;
+}
+
+duk_size_t
+dukky_example_init_get_offsets(duk_context *ctx, duk_idx_t idx, int argi, long long **seq_out)
+{
+	duk_size_t ret = 0; /* No default */
+	duk_size_t seqi;
+	long long *seq;
+	*seq_out = NULL;
+	idx = duk_normalize_index(ctx, idx);
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_offsets);
+	duk_get_prop(ctx, idx);
+	/* ... obj@idx ... value/undefined */
+	if (!duk_is_undefined(ctx, -1)) {
+		/* Note, this throws a duk_error if it's not a sequence */
+		ret = dukky_get_longlong_sequence(ctx, -1, argi, "offsets", &seq);
+		/* ... obj@idx ... value elements */
+		if (ret > 0) {
+			*seq_out = malloc(ret * sizeof(*seq));
+			if (*seq_out == NULL) {
+				return duk_error(ctx, DUK_ERR_ERROR, "out of memory");
+			}
+		}
+		for (seqi = 0; seqi < ret; seqi++) {
+			(*seq_out)[seqi] = seq[seqi];
+		}
+		duk_pop(ctx);
+	}
+	duk_pop(ctx);
+	/* ... obj@idx ... */
+	return ret;
+}
+
+void
+dukky_example_init_unpack(duk_context *ctx, duk_idx_t idx, example_init_members_t *out)
+{
+	idx = duk_normalize_index(ctx, idx);
+	out->flag = false; /* Default value of flag */
+	out->name = "example"; /* Default value of name */
+	out->count = 0; /* No default */
+	if (!duk_is_object(ctx, idx)) {
+		return;
+	}
+	/* ... obj@idx ... */
+	dukky_push_key(ctx, DUKKY_KEY_flag);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->flag = duk_require_boolean(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_name);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->name = duk_require_string(ctx, -1);
+	}
+	duk_pop(ctx);
+	dukky_push_key(ctx, DUKKY_KEY_count);
+	duk_get_prop(ctx, idx);
+	if (!duk_is_undefined(ctx, -1)) {
+		out->count = duk_require_int(ctx, -1);
+	}
+	duk_pop(ctx);
+}
+
+
@@ -0,0 +1,25 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_private_h
+#define dukky_private_h
+
+/* Private data for ExampleInit dictionary */
+typedef struct {
+} __attribute__((aligned)) example_init_private_t;
+
+/* Private data for DerivedExampleInit dictionary */
+typedef struct {
+	example_init_private_t parent;
+} __attribute__((aligned)) derived_example_init_private_t;
+
+/* Private data for DictionaryExample interface */
+typedef struct {
+} __attribute__((aligned)) dictionary_example_private_t;
+
+
+#endif
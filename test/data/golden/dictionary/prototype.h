@@ -0,0 +1,35 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_prototype_h
+#define dukky_prototype_h
+
+/* Unpacked members of ExampleInit dictionary */
+typedef struct {
+	duk_bool_t flag;
+	const char *name;
+	duk_int_t count;
+	/* offsets not unpacked (type 11) */
+} example_init_members_t;
+void dukky_example_init_unpack(duk_context *ctx, duk_idx_t idx, example_init_members_t *out);
+duk_bool_t dukky_example_init_get_flag(duk_context *ctx, duk_idx_t idx);
+const char *dukky_example_init_get_name(duk_context *ctx, duk_idx_t idx);
+duk_int_t dukky_example_init_get_count(duk_context *ctx, duk_idx_t idx);
+duk_size_t dukky_example_init_get_offsets(duk_context *ctx, duk_idx_t idx, int argi, long long **seq_out);
+/* Unpacked members of DerivedExampleInit dictionary */
+typedef struct {
+	example_init_members_t parent;
+	/* detail not unpacked (type 0) */
+	duk_int_t kind;
+} derived_example_init_members_t;
+void dukky_derived_example_init_unpack(duk_context *ctx, duk_idx_t idx, derived_example_init_members_t *out);
+/* Dictionary DerivedExampleInit:detail unhandled type (0) */
+duk_int_t dukky_derived_example_init_get_kind(duk_context *ctx, duk_idx_t idx);
+duk_ret_t dukky_dictionary_example___proto(duk_context *ctx, void *udata);
+
+
+#endif
@@ -0,0 +1,154 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#include "@OUTPUT@/binding.h"
+#include "@OUTPUT@/private.h"
+#include "@OUTPUT@/prototype.h"
+
+static void dukky_html_derived_example_element___init(duk_context *ctx, html_derived_example_element_private_t *priv, struct dom_html_element *html_derived_example_element)
+{
+	/* HTMLExampleElement initialiser */
+	{
+	html_example_element_private_t *dukky_parent_priv = &priv->parent;
+	struct dom_html_element *dukky_parent_html_example_element = html_derived_example_element;
+	{
+	html_example_element_private_t *priv = dukky_parent_priv;
+	struct dom_html_element *html_example_element = dukky_parent_html_example_element;
+	dukky_html_element___init(ctx, &priv->parent, html_example_element);
+#line 59 "flatinit.bnd"
+
+	priv->count = 0;
+#line 26 "html_derived_example_element.c"
+	}
+	}
+	NSLOG(dukky, INFO, "Initialise %p (priv=%p)", duk_get_heapptr(ctx, 0), priv);
+#line 69 "flatinit.bnd"
+#line 31 "html_derived_example_element.c"
+}
+
+static void dukky_html_derived_example_element___fini(duk_context *ctx, html_derived_example_element_private_t *priv)
+{
+	NSLOG(dukky, INFO, "Finalise %p", duk_get_heapptr(ctx, 0));
+	/* HTMLExampleElement finaliser */
+	{
+	html_example_element_private_t *dukky_parent_priv = &priv->parent;
+	{
+	html_example_element_private_t *priv = dukky_parent_priv;
+
+	priv->count = -1;
+	/* Node finaliser */
+	{
+	node_private_t *dukky_parent_priv = &priv->parent.parent.parent;
+	{
+	node_private_t *priv = dukky_parent_priv;
+
+	dom_node_unref(priv->node);
+	}
+	}
+	}
+	}
+}
+
+static duk_ret_t dukky_html_derived_example_element___constructor(duk_context *ctx)
+{
+	/* create private data and attach to instance */
+	html_derived_example_element_private_t *priv = calloc(1, sizeof(*priv));
+	if (priv == NULL) return 0;
+	duk_push_pointer(ctx, priv);
+	duk_put_prop_string(ctx, 0, dukky_magic_string_private);
+
+	dukky_html_derived_example_element___init(ctx, priv, duk_get_pointer(ctx, 1));
+	duk_set_top(ctx, 1);
+	return 1;
+}
+
+static duk_ret_t dukky_html_derived_example_element___destructor(duk_context *ctx)
+{
+	html_derived_example_element_private_t *priv;
+	duk_get_prop_string(ctx, 0, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+	if (priv == NULL) return 0;
+
+	dukky_html_derived_example_element___fini(ctx, priv);
+	free(priv);
+	return 0;
+}
+
+static duk_ret_t dukky_html_derived_example_element_value_getter(duk_context *ctx)
+{
+	/* Get private data for method */
+	html_derived_example_element_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+static duk_ret_t dukky_html_derived_example_element_value_setter(duk_context *ctx)
+{
+	/* Get private data for method */
+	html_derived_example_element_private_t *priv = NULL;
+	duk_push_this(ctx);
+	duk_get_prop_string(ctx, -1, dukky_magic_string_private);
+	priv = duk_get_pointer(ctx, -1);
+	duk_pop_2(ctx);
+	if (priv == NULL) {
+		NSLOG(dukky, INFO, "priv failed");
+		return 0; /* can do? No can do. */
+	}
+
+	NSLOG(dukky, WARNING, "Unimplemented");
+	return 0;
+}
+
+duk_ret_t dukky_html_derived_example_element___proto(duk_context *ctx, void *udata)
+{
+	/* Set this prototype's prototype (left-parent) */
+	/* get prototype */
+	duk_get_global_string(ctx, dukky_magic_string_prototypes);
+	duk_get_prop_string(ctx, -1, "\xFF\xFFNETSURF_DUKTAPE_PROTOTYPE_HTMLEXAMPLEELEMENT");
+	duk_replace(ctx, -2);
+	duk_set_prototype(ctx, 0);
+
+	/* Add read/write property */
+	duk_dup(ctx, 0);
+	duk_push_string(ctx, "value");
+	duk_push_c_function(ctx, dukky_html_derived_example_element_value_getter, 0);
+	duk_push_c_function(ctx, dukky_html_derived_example_element_value_setter, 1);
+	duk_push_context_dump(ctx);
+	NSLOG(dukky, DEEPDEBUG, "Stack: %s", duk_to_string(ctx, -1));
+	duk_pop(ctx);
+	duk_def_prop(ctx, -4, DUK_DEFPROP_HAVE_GETTER |
+		DUK_DEFPROP_HAVE_SETTER |
+		DUK_DEFPROP_HAVE_ENUMERABLE | DUK_DEFPROP_ENUMERABLE |
+		DUK_DEFPROP_HAVE_CONFIGURABLE);
+	duk_pop(ctx);
+
+	/* Set the destructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_html_derived_example_element___destructor, 1);
+	duk_set_finalizer(ctx, -2);
+	duk_pop(ctx);
+
+	/* Set the constructor */
+	duk_dup(ctx, 0);
+	duk_push_c_function(ctx, dukky_html_derived_example_element___constructor, 2);
+	duk_put_prop_string(ctx, -2, "\xFF\xFFNETSURF_DUKTAPE_INIT");
+	duk_pop(ctx);
+
+	return 1; /* The prototype object */
+}
+
+
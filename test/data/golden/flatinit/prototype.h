@@ -0,0 +1,30 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_prototype_h
+#define dukky_prototype_h
+
+duk_ret_t dukky_node___proto(duk_context *ctx, void *udata);
+void dukky_node___fini(duk_context *ctx, node_private_t *priv);
+void dukky_node___init(duk_context *ctx, node_private_t *priv, struct dom_node *node);
+
+duk_ret_t dukky_element___proto(duk_context *ctx, void *udata);
+void dukky_element___fini(duk_context *ctx, element_private_t *priv);
+void dukky_element___init(duk_context *ctx, element_private_t *priv, struct dom_element *element);
+
+duk_ret_t dukky_html_element___proto(duk_context *ctx, void *udata);
+void dukky_html_element___fini(duk_context *ctx, html_element_private_t *priv);
+void dukky_html_element___init(duk_context *ctx, html_element_private_t *priv, struct dom_html_element *html_element);
+
+duk_ret_t dukky_html_example_element___proto(duk_context *ctx, void *udata);
+void dukky_html_example_element___fini(duk_context *ctx, html_example_element_private_t *priv);
+void dukky_html_example_element___init(duk_context *ctx, html_example_element_private_t *priv, struct dom_html_element *html_example_element);
+
+duk_ret_t dukky_html_derived_example_element___proto(duk_context *ctx, void *udata);
+
+
+#endif
@@ -0,0 +1,95 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_binding_h
+#define dukky_binding_h
+
+#define _MAGIC(S) ("\xFF\xFFNETSURF_DUKTAPE_" S)
+#define MAGIC(S) _MAGIC(#S)
+#define PROTO_MAGIC MAGIC(PROTOTYPES)
+#define PRIVATE_MAGIC MAGIC(PRIVATE)
+#define INIT_MAGIC MAGIC(INIT)
+#define NODE_MAGIC MAGIC(NODE_MAP)
+#define _PROTO_NAME(K) _MAGIC("PROTOTYPE_" K)
+#define PROTO_NAME(K) _PROTO_NAME(#K)
+#define _PROP_NAME(K,V) _MAGIC(K "_PROPERTY_" V)
+#define PROP_NAME(K,V) _PROP_NAME(#K,#V)
+
+/* Constant strings */
+extern const char *dukky_error_fmt_argument;
+extern const char *dukky_error_fmt_bool_type;
+extern const char *dukky_error_fmt_number_type;
+extern const char *dukky_error_fmt_sequence_type;
+extern const char *dukky_magic_string_private;
+extern const char *dukky_magic_string_prototypes;
+extern const char *dukky_magic_string_keys;
+
+duk_bool_t dukky_instanceof(duk_context *ctx, duk_idx_t index, const char *klass);
+/* Sequence marshalling */
+duk_idx_t dukky_push_string_sequence(duk_context *ctx, const char *const *seq, duk_size_t seqc);
+duk_size_t dukky_get_string_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, const char ***seq_out);
+duk_idx_t dukky_push_boolean_sequence(duk_context *ctx, duk_bool_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_boolean_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_bool_t **seq_out);
+duk_idx_t dukky_push_int_sequence(duk_context *ctx, duk_int_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_int_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_int_t **seq_out);
+duk_idx_t dukky_push_number_sequence(duk_context *ctx, duk_double_t const *seq, duk_size_t seqc);
+duk_size_t dukky_get_number_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, duk_double_t **seq_out);
+duk_idx_t dukky_push_longlong_sequence(duk_context *ctx, long long const *seq, duk_size_t seqc);
+duk_size_t dukky_get_longlong_sequence(duk_context *ctx, duk_idx_t idx, int argi, const char *argname, long long **seq_out);
+
+duk_ret_t dukky_create_prototypes(duk_context *ctx);
+
+/* Profiling */
+#include <stdio.h>
+
+typedef struct dukky_profile_entry {
+	const char *interface;
+	const char *kind;
+	const char *member;
+	unsigned long calls;
+	unsigned long long nsec;
+} dukky_profile_entry_t;
+
+extern dukky_profile_entry_t dukky_profile_table[];
+
+#ifdef DUKKY_PROFILE_TIME
+#include <time.h>
+
+typedef struct dukky_profile_sample {
+	int idx;
+	unsigned long long start;
+} dukky_profile_sample_t;
+
+static inline unsigned long long dukky_profile_clock(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((unsigned long long)ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
+static inline void dukky_profile_leave(dukky_profile_sample_t *sample)
+{
+	dukky_profile_table[sample->idx].nsec += dukky_profile_clock() - sample->start;
+}
+
+#define DUKKY_PROFILE(IDX) \
+	dukky_profile_sample_t dukky_profile_sample __attribute__((cleanup(dukky_profile_leave))) = \
+		{ (IDX), (dukky_profile_table[(IDX)].calls++, dukky_profile_clock()) }
+#else
+#define DUKKY_PROFILE(IDX) \
+	unsigned long dukky_profile_calls __attribute__((unused)) = dukky_profile_table[(IDX)].calls++
+#endif
+
+void dukky_profile_dump(FILE *outf);
+
+/* Shared accessors of reflected content attributes */
+duk_ret_t dukky_reflect_string_getter(duk_context *ctx);
+duk_ret_t dukky_reflect_string_setter(duk_context *ctx);
+duk_ret_t dukky_reflect_bool_getter(duk_context *ctx);
+duk_ret_t dukky_reflect_bool_setter(duk_context *ctx);
+
+#endif
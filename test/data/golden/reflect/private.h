@@ -0,0 +1,31 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_private_h
+#define dukky_private_h
+
+/* Private data for Example interface */
+typedef struct {
+} __attribute__((aligned)) example_private_t;
+
+/* Private data for Node interface */
+typedef struct {
+	dom_node *node;
+} __attribute__((aligned)) node_private_t;
+
+/* Private data for Element interface */
+typedef struct {
+	node_private_t parent;
+} __attribute__((aligned)) element_private_t;
+
+/* Private data for HTMLExampleElement interface */
+typedef struct {
+	element_private_t parent;
+} __attribute__((aligned)) html_example_element_private_t;
+
+
+#endif
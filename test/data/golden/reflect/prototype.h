@@ -0,0 +1,24 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_prototype_h
+#define dukky_prototype_h
+
+duk_ret_t dukky_example___proto(duk_context *ctx, void *udata);
+
+duk_ret_t dukky_node___proto(duk_context *ctx, void *udata);
+void dukky_node___fini(duk_context *ctx, node_private_t *priv);
+void dukky_node___init(duk_context *ctx, node_private_t *priv, struct dom_node *node);
+
+duk_ret_t dukky_element___proto(duk_context *ctx, void *udata);
+void dukky_element___fini(duk_context *ctx, element_private_t *priv);
+void dukky_element___init(duk_context *ctx, element_private_t *priv, struct dom_element *element);
+
+duk_ret_t dukky_html_example_element___proto(duk_context *ctx, void *udata);
+
+
+#endif
@@ -0,0 +1,16 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_private_h
+#define dukky_private_h
+
+/* Private data for SequenceExample interface */
+typedef struct {
+} __attribute__((aligned)) sequence_example_private_t;
+
+
+#endif
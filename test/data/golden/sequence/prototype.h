@@ -0,0 +1,14 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+#ifndef dukky_prototype_h
+#define dukky_prototype_h
+
+duk_ret_t dukky_sequence_example___proto(duk_context *ctx, void *udata);
+
+
+#endif
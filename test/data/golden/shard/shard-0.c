@@ -0,0 +1,11 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* Unity build shard 1 of 2 */
+#include "@OUTPUT@/text.c"
+#include "@OUTPUT@/element.c"
+#include "@OUTPUT@/html_element.c"
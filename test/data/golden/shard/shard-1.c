@@ -0,0 +1,10 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* Unity build shard 2 of 2 */
+#include "@OUTPUT@/location.c"
+#include "@OUTPUT@/node.c"
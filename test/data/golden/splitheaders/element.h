@@ -0,0 +1,25 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_element_h
+#define dukky_element_h
+
+#include "@OUTPUT@/node.h"
+
+/* Private data for Element interface */
+typedef struct {
+	node_private_t parent;
+} __attribute__((aligned)) element_private_t;
+
+duk_ret_t dukky_element___proto(duk_context *ctx, void *udata);
+void dukky_element___fini(duk_context *ctx, element_private_t *priv);
+void dukky_element___init(duk_context *ctx, element_private_t *priv, struct dom_element *element);
+
+
+#endif
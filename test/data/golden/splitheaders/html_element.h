@@ -0,0 +1,23 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_html_element_h
+#define dukky_html_element_h
+
+#include "@OUTPUT@/element.h"
+
+/* Private data for HTMLElement interface */
+typedef struct {
+	element_private_t parent;
+} __attribute__((aligned)) html_element_private_t;
+
+duk_ret_t dukky_html_element___proto(duk_context *ctx, void *udata);
+
+
+#endif
@@ -0,0 +1,23 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_node_h
+#define dukky_node_h
+
+/* Private data for Node interface */
+typedef struct {
+	dom_node *node;
+} __attribute__((aligned)) node_private_t;
+
+duk_ret_t dukky_node___proto(duk_context *ctx, void *udata);
+void dukky_node___fini(duk_context *ctx, node_private_t *priv);
+void dukky_node___init(duk_context *ctx, node_private_t *priv, struct dom_node *node);
+
+
+#endif
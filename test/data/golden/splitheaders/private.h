@@ -0,0 +1,19 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_private_h
+#define dukky_private_h
+
+#include "@OUTPUT@/location.h"
+#include "@OUTPUT@/node.h"
+#include "@OUTPUT@/text.h"
+#include "@OUTPUT@/element.h"
+#include "@OUTPUT@/html_element.h"
+
+#endif
@@ -0,0 +1,23 @@
+/* Generated by nsgenbind
+ *
+ * nsgenbind is published under the MIT Licence.
+ * nsgenbind is similar to a compiler is a purely transformative tool which
+ * explicitly makes no copyright claim on this generated output
+ */
+
+/* binding preface */
+
+#ifndef dukky_text_h
+#define dukky_text_h
+
+#include "@OUTPUT@/node.h"
+
+/* Private data for Text interface */
+typedef struct {
+	node_private_t parent;
+} __attribute__((aligned)) text_private_t;
+
+duk_ret_t dukky_text___proto(duk_context *ctx, void *udata);
+
+
+#endif
@@ -0,0 +1,218 @@
+#!/bin/sh
+#
+# Generator throughput benchmark
+#
+# Synthesises Web IDL and binding inputs of increasing size and records
+# the time nsgenbind spends in each phase generating them.
+#
+# usage: genbench.sh builddir testsrcdir [interfaces ...]
+
+BUILDDIR=$1
+TESTSRCDIR=$2
+shift 2
+
+# interface counts to benchmark
+SCALES=${*:-"100 250 500 1000"}
+
+# length of inheritance chains
+DEPTH=${BENCH_DEPTH:-16}
+# attributes on each interface
+ATTRIBUTES=${BENCH_ATTRIBUTES:-8}
+# overloads of each operation
+OVERLOADS=${BENCH_OVERLOADS:-4}
+# number of mixin interfaces implemented
+MIXINS=${BENCH_MIXINS:-32}
+# lines in each binding code block
+CDATA=${BENCH_CDATA:-40}
+
+# growth between successive scales beyond this multiple of linear is flagged
+SUPERLINEAR=${BENCH_SUPERLINEAR:-2}
+# multiple of the baseline time a phase may take before the bench fails
+RATIO=${BENCH_RATIO:-1.5}
+# phase times in seconds below which comparisons are too noisy to make
+FLOOR=${BENCH_FLOOR:-0.05}
+
+# locations
+BENCHOUTDIR=${BUILDDIR}/bench
+RESULTFILE=${BENCHOUTDIR}/results
+BASELINE=${BENCH_BASELINE:-${BENCHOUTDIR}/baseline}
+
+# genbind tool
+NSGENBIND=${BUILDDIR}/nsgenbind
+
+# generate IDL and binding for a number of interfaces
+genbench() {
+    awk -v count=$1 -v depth=${DEPTH} -v attrs=${ATTRIBUTES} \
+        -v overloads=${OVERLOADS} -v mixins=${MIXINS} -v cdata=${CDATA} \
+        -v dir=$2 '
+function cblock(name, term,    line) {
+    print "%{" > bnd
+    for (line = 0; line < cdata; line++) {
+        printf "\t/* %s line %d */ priv->value += %d;\n", name, line, line > bnd
+    }
+    print "%}" term > bnd
+    print "" > bnd
+}
+
+BEGIN {
+    idl = dir "/bench.idl"
+    partial = dir "/bench-partial.idl"
+    bnd = dir "/bench.bnd"
+
+    # mixins implemented by the interfaces
+    for (m = 0; m < mixins; m++) {
+        printf "[NoInterfaceObject]\ninterface BenchMixin%d {\n", m > idl
+        printf "  attribute DOMString mixin%dName;\n", m > idl
+        printf "  void mixin%dAction(long arg);\n", m > idl
+        print "};\n" > idl
+    }
+
+    for (i = 0; i < count; i++) {
+        # inheritance chains of depth interfaces
+        if ((i % depth) == 0) {
+            printf "interface Bench%d {\n", i > idl
+        } else {
+            printf "interface Bench%d : Bench%d {\n", i, i - 1 > idl
+        }
+        printf "  const unsigned short BENCH_%d = %d;\n", i, i > idl
+        for (a = 0; a < attrs; a++) {
+            printf "  attribute long attr%d_%d;\n", i, a > idl
+        }
+        for (o = 0; o < overloads; o++) {
+            printf "  long op%d(", i > idl
+            for (p = 0; p <= o; p++) {
+                printf "%slong arg%d", (p == 0) ? "" : ", ", p > idl
+            }
+            print ");" > idl
+        }
+        print "};\n" > idl
+
+        printf "Bench%d implements BenchMixin%d;\n\n", i, i % mixins > idl
+
+        # a large partial for every interface
+        printf "partial interface Bench%d {\n", i > partial
+        for (a = 0; a < attrs; a++) {
+            printf "  readonly attribute DOMString partial%d_%d;\n", i, a > partial
+        }
+        printf "  void partialOp%d(optional DOMString arg);\n", i > partial
+        print "};\n" > partial
+
+        printf "dictionary BenchDict%d {\n  long member%d = %d;\n};\n\n", i, i, i > partial
+    }
+
+    print "binding duk_libdom {" > bnd
+    print "\twebidl \"bench.idl\";" > bnd
+    print "\twebidl \"bench-partial.idl\";" > bnd
+    print "\tpreface" > bnd
+    cblock("preface", ";")
+    print "};\n" > bnd
+
+    for (i = 0; i < count; i++) {
+        if ((i % depth) == 0) {
+            printf "class Bench%d {\n\tprivate int value;\n};\n\n", i > bnd
+        }
+        printf "init Bench%d()\n", i > bnd
+        cblock("init", "")
+        printf "getter Bench%d::attr%d_0()\n", i, i > bnd
+        cblock("getter", "")
+        printf "setter Bench%d::attr%d_0()\n", i, i > bnd
+        cblock("setter", "")
+        printf "method Bench%d::op%d()\n", i, i > bnd
+        cblock("method", "")
+    }
+}'
+}
+
+# flag phases growing faster than the interface count between scales
+superlinear() {
+    awk -v limit=${SUPERLINEAR} -v floor=${FLOOR} '
+NR == 1 {
+    for (c = 2; c <= NF; c++) phase[c] = $c
+    next
+}
+
+{
+    for (c = 2; (NR > 2) && (c <= NF); c++) {
+        if (($c > floor) && (last[c] > 0) &&
+            (($c / last[c]) > (limit * $1 / lastscale))) {
+            printf "superlinear: %s %.3fs at %d interfaces, %.3fs at %d\n",
+                phase[c], last[c], lastscale, $c, $1
+        }
+    }
+    lastscale = $1
+    for (c = 2; c <= NF; c++) last[c] = $c
+}' $1
+}
+
+# compare results with a baseline, failing on phases over the ratio
+regressions() {
+    awk -v ratio=${RATIO} -v floor=${FLOOR} '
+FILENAME == ARGV[1] {
+    for (c = 2; c <= NF; c++) base[$1, c] = $c
+    next
+}
+
+FNR == 1 {
+    for (c = 2; c <= NF; c++) phase[c] = $c
+    next
+}
+
+{
+    for (c = 2; c <= NF; c++) {
+        if ((($1, c) in base) && ($c > floor) &&
+            ($c > (base[$1, c] * ratio))) {
+            printf "regression: %s %.3fs at %d interfaces, baseline %.3fs\n",
+                phase[c], $c, $1, base[$1, c]
+            failed = 1
+        }
+    }
+}
+
+END {
+    exit failed
+}' $1 $2
+}
+
+# extract a phase wall clock time from JSON statistics
+phase_wall() {
+    sed -n "s/.*\"$1\": { \"calls\": [0-9]*, \"wall\": \([0-9.]*\).*/\1/p" $2
+}
+
+mkdir -p ${BENCHOUTDIR}
+
+printf "%10s %10s %10s %10s %10s %10s %10s\n" interfaces binding idl merge implements ir output | tee ${RESULTFILE}
+
+for SCALE in ${SCALES};do
+
+  SCALEDIR=${BENCHOUTDIR}/${SCALE}
+  rm -rf ${SCALEDIR}
+  mkdir -p ${SCALEDIR}/output
+
+  genbench ${SCALE} ${SCALEDIR}
+
+  ${NSGENBIND} -Tjson -I ${SCALEDIR} ${SCALEDIR}/bench.bnd ${SCALEDIR}/output >${SCALEDIR}/stats.json 2>${SCALEDIR}/errors
+
+  if [ $? -ne 0 ]; then
+    echo "${SCALE}: FAIL"
+    cat ${SCALEDIR}/errors
+    exit 1
+  fi
+
+  printf "%10s %10s %10s %10s %10s %10s %10s\n" ${SCALE} \
+      $(phase_wall binding_parse ${SCALEDIR}/stats.json) \
+      $(phase_wall idl_parse ${SCALEDIR}/stats.json) \
+      $(phase_wall idl_merge ${SCALEDIR}/stats.json) \
+      $(phase_wall idl_intercalate ${SCALEDIR}/stats.json) \
+      $(phase_wall ir ${SCALEDIR}/stats.json) \
+      $(phase_wall output ${SCALEDIR}/stats.json) | tee -a ${RESULTFILE}
+
+done
+
+superlinear ${RESULTFILE}
+
+if [ "${BENCH_MODE}" = "update" ]; then
+  cp ${RESULTFILE} ${BASELINE}
+  echo "baseline recorded in ${BASELINE}"
+elif [ -f ${BASELINE} ]; then
+  regressions ${BASELINE} ${RESULTFILE} || exit 1
+fi
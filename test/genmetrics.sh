@@ -0,0 +1,58 @@
+#!/bin/sh
+#
+# Generated code metrics
+#
+# Reports the cost of each function in generated binding sources as
+#  file:function lines duk_calls string_lookups allocations
+#
+# usage: genmetrics.sh outputdir
+
+OUTPUTDIR=$1
+
+for SOURCE in ${OUTPUTDIR}/*.c;do
+
+  awk -v file=$(basename ${SOURCE}) '
+# count matches of a pattern in a line
+function count(line, pattern,    n) {
+    n = 0
+    while (match(line, pattern)) {
+        n++
+        line = substr(line, RSTART + RLENGTH)
+    }
+    return n
+}
+
+/^{/ {
+    # function body begins, its name is in the declaration before
+    name = prev
+    sub(/\(.*/, "", name)
+    sub(/.*[ *]/, "", name)
+    infunc = 1
+    lines = 0
+    duk = 0
+    lookups = 0
+    allocs = 0
+    next
+}
+
+/^}/ {
+    if (infunc) {
+        printf "%s:%s %d %d %d %d\n", file, name, lines, duk, lookups, allocs
+    }
+    infunc = 0
+    next
+}
+
+{
+    prev = $0
+    if (!infunc) {
+        next
+    }
+    lines++
+    duk += count($0, "(^|[^a-z_])duk_[a-z0-9_]+\\(")
+    lookups += count($0, "duk_(get|has)_prop_l?string\\(|duk_get_global_l?string\\(")
+    allocs += count($0, "(^|[^a-z_])(malloc|calloc|realloc|strdup|strndup|duk_alloc|duk_push_buffer|duk_push_fixed_buffer|duk_push_dynamic_buffer|dom_string_create|dom_string_create_interned)\\(")
+}
+' ${SOURCE}
+
+done | sort
@@ -6,6 +6,74 @@ echo "-----------------------------------------------------------"  >>${LOGFILE}
 echo >>${LOGFILE}
 }
 
+# compare generated sources and their metrics with the expected ones
+#
+# The sources are compared with paths to the test directories removed.
+# The metrics of each generated function must not exceed the expected
+# line count (plus METRICS_LINE_SLACK percent), duk call count, string
+# property lookup count or allocation count. Generated functions without
+# expected metrics and expected functions no longer generated fail too.
+golden_check() {
+  EXPECTDIR=${GOLDENDIR}/$1
+  NORMALDIR=$2/normal
+
+  rm -rf ${NORMALDIR}
+  mkdir -p ${NORMALDIR}
+  for SOURCE in $2/*.c $2/*.h;do
+    [ -f ${SOURCE} ] || continue
+    sed -e "s|$2|@OUTPUT@|g" -e "s|${BINDINGDIR}/||g" ${SOURCE} >${NORMALDIR}/$(basename ${SOURCE})
+  done
+  ${METRICS} ${NORMALDIR} >$2/metrics
+
+  if [ "${GOLDEN_MODE}" = "update" ]; then
+    # only tests which generate sources have expected output
+    if [ -n "$(ls ${NORMALDIR})" ]; then
+      rm -rf ${EXPECTDIR}
+      mkdir -p ${EXPECTDIR}
+      cp ${NORMALDIR}/* ${EXPECTDIR}/
+      cp $2/metrics ${EXPECTDIR}/metrics
+    fi
+    return 0
+  fi
+
+  if [ ! -d ${EXPECTDIR} ]; then
+    return 0
+  fi
+
+  echo "    diff ${EXPECTDIR} ${NORMALDIR}" >>${LOGFILE}
+  diff -r -x metrics ${EXPECTDIR} ${NORMALDIR} >$2/golden.diff
+  GOLDENRES=$?
+  cat $2/golden.diff >>${LOGFILE}
+
+  awk -v slack=${METRICS_LINE_SLACK:-0} '
+    FILENAME == ARGV[1] { lines[$1] = $2; duk[$1] = $3; lookups[$1] = $4; allocs[$1] = $5; next }
+    { generated[$1] = 1 }
+    !($1 in lines) {
+      printf "    no expected metrics for %s\n", $1
+      failed = 1
+      next
+    }
+    ($2 > lines[$1] + (lines[$1] * slack / 100)) ||
+    ($3 > duk[$1]) || ($4 > lookups[$1]) || ($5 > allocs[$1]) {
+      printf "    more expensive %s lines %d>%d duk %d>%d lookups %d>%d allocs %d>%d\n",
+             $1, $2, lines[$1], $3, duk[$1], $4, lookups[$1], $5, allocs[$1]
+      failed = 1
+    }
+    END {
+      for (name in lines) {
+        if (!(name in generated)) {
+          printf "    expected %s not generated\n", name
+          failed = 1
+        }
+      }
+      exit failed
+    }
+  ' ${EXPECTDIR}/metrics $2/metrics >>${LOGFILE}
+  METRICSRES=$?
+
+  [ ${GOLDENRES} -eq 0 ] && [ ${METRICSRES} -eq 0 ]
+}
+
 BUILDDIR=$1
 TESTSRCDIR=$2
 
@@ -24,10 +92,19 @@ BINDINGTESTS=$(ls ${BINDINGDIR}/*.bnd)
 
 IDLDIR=${TESTSRCDIR}/data/idl
 
+# expected generated output, GOLDEN_MODE=update replaces it
+GOLDENDIR=${TESTSRCDIR}/data/golden
+
+# generated code metrics
+METRICS=${TESTSRCDIR}/genmetrics.sh
+
 mkdir -p ${TESTOUTDIR}
 
 echo "$*" >${LOGFILE}
 
+# number of tests with an unexpected result
+FAILURES=0
+
 for TEST in ${BINDINGTESTS};do
 
   outline
@@ -44,9 +121,15 @@ for TEST in ${BINDINGTESTS};do
   # per test errors
   ERRFILE=${TESTDIR}/testerr
 
-  echo  ${NSGENBIND} -v -D -g -I ${IDLDIR} ${TEST} ${TESTOUTDIR}/${TESTNAME} >>${LOGFILE} 2>&1
+  # additional switches the binding is tested with
+  FLAGS=
+  if [ -f ${BINDINGDIR}/${TESTNAME}.flags ]; then
+    FLAGS=$(cat ${BINDINGDIR}/${TESTNAME}.flags)
+  fi
+
+  echo  ${NSGENBIND} -v -D -g ${FLAGS} -I ${IDLDIR} ${TEST} ${TESTOUTDIR}/${TESTNAME} >>${LOGFILE} 2>&1
 
-  ${NSGENBIND} -v -D -g -I ${IDLDIR} ${TEST} ${TESTOUTDIR}/${TESTNAME} >${RESFILE} 2>${ERRFILE}
+  ${NSGENBIND} -v -D -g ${FLAGS} -I ${IDLDIR} ${TEST} ${TESTOUTDIR}/${TESTNAME} >${RESFILE} 2>${ERRFILE}
 
   RESULT=$?
 
@@ -56,11 +139,30 @@ for TEST in ${BINDINGTESTS};do
   cat ${RESFILE} >> ${LOGFILE}
 
   if [ ${RESULT} -eq 0 ]; then
+    golden_check ${TESTNAME} ${TESTDIR}
+    RESULT=$?
+  fi
+
+  # bindings the tool is known to reject are expected to fail
+  if [ -f ${BINDINGDIR}/${TESTNAME}.xfail ]; then
+    if [ ${RESULT} -eq 0 ]; then
+      echo "XPASS"
+      FAILURES=$((FAILURES + 1))
+    else
+      echo "XFAIL"
+    fi
+  elif [ ${RESULT} -eq 0 ]; then
     echo "PASS"
   else
     echo "FAIL"
+    FAILURES=$((FAILURES + 1))
   fi
   
 
 done
 
+if [ ${FAILURES} -ne 0 ]; then
+  echo "    ${FAILURES} tests failed, see ${LOGFILE}"
+  exit 1
+fi
+